@@ -0,0 +1,89 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   bm01_Param_Handles.cpp
+ * @brief  Cost of parameter handle churn over the number of handles
+ * @author Accellera CCI Working Group
+ *
+ * Creates, copies and destroys (in random order) a growing number of
+ * handles of a single parameter, and finally destroys the parameter,
+ * which invalidates all of its handles.  The cost per handle should stay
+ * flat as the number of handles grows.
+ */
+
+#include <cci_configuration>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "bm_timer.h"
+
+/**
+ *  @fn     int sc_main(int argc, char* argv[])
+ *  @brief  Runs the benchmark
+ *  @param  argc  An integer for the number of input arguments
+ *  @param  argv  A list of the input arguments
+ *  @return An integer denoting the return status of execution.
+ */
+int sc_main(int argc, char *argv[]) {
+  cci::cci_register_broker(new cci_utils::broker("My Global Broker"));
+  const cci::cci_originator originator("bm01");
+
+  std::printf("%10s %12s %12s %12s %12s   (ns per handle)\n",
+              "handles", "create", "copy", "destroy", "invalidate");
+  for (std::size_t count = 1000; count <= 1000000; count *= 10) {
+    cci::cci_param<int>* freq = new cci::cci_param<int>(
+        "freq", 100, "", cci::CCI_ABSOLUTE_NAME, originator);
+
+    bm_timer timer;
+    std::vector<cci::cci_param_untyped_handle*> handles(count);
+    for (std::size_t i = 0; i < count; ++i)
+      handles[i] = new cci::cci_param_untyped_handle(
+          freq->create_param_handle(originator));
+    const double create = timer.ns_per(count);
+
+    timer.restart();
+    std::vector<cci::cci_param_untyped_handle*> copies(count);
+    for (std::size_t i = 0; i < count; ++i)
+      copies[i] = new cci::cci_param_untyped_handle(*handles[i]);
+    const double copy = timer.ns_per(count);
+
+    // destroy the copies in random order
+    std::srand(1);
+    for (std::size_t i = count; i > 1; --i)
+      std::swap(copies[i - 1], copies[std::rand() % i]);
+    timer.restart();
+    for (std::size_t i = 0; i < count; ++i)
+      delete copies[i];
+    const double destroy = timer.ns_per(count);
+
+    timer.restart();
+    delete freq;
+    const double invalidate = timer.ns_per(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+      delete handles[i];
+
+    std::printf("%10lu %12.1f %12.1f %12.1f %12.1f\n",
+                static_cast<unsigned long>(count),
+                create, copy, destroy, invalidate);
+  }
+  return EXIT_SUCCESS;
+}
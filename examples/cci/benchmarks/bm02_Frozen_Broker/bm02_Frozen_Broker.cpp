@@ -0,0 +1,134 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   bm02_Frozen_Broker.cpp
+ * @brief  Broker lookups and walks before and after freezing the broker
+ * @author Accellera CCI Working Group
+ *
+ * Registers 100k parameters (plus 100k preset values) in a three level
+ * hierarchy, in random order, and measures name lookups (in random and in
+ * name order), preset queries and ordered walks before and after
+ * cci_utils::consuming_broker::freeze().
+ */
+
+#include <cci_configuration>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "bm_timer.h"
+
+namespace {
+
+const std::size_t param_count = 100000;
+const std::size_t lookup_count = 1000000;
+
+/// Visitor counting the parameters
+struct counter {
+  explicit counter(std::size_t& c) : count(c) {}
+  bool operator()(const cci::cci_param_view&) const { ++count; return true; }
+  std::size_t& count;
+};
+
+/// Looks up handles of the given parameters, returns the time per lookup
+double lookup(cci_utils::broker& broker, const std::vector<std::string>& names,
+              const cci::cci_originator& originator, std::size_t& found) {
+  bm_timer timer;
+  for (std::size_t i = 0; i < lookup_count; ++i)
+    found += broker.get_param_handle(names[i % names.size()],
+                                     originator).is_valid();
+  return timer.ns_per(lookup_count);
+}
+
+/// Runs the measured operations, printing the time per operation
+void measure(const char* state, cci_utils::broker& broker,
+             const std::vector<std::string>& names,
+             const std::vector<std::string>& ordered,
+             const cci::cci_originator& originator) {
+  std::size_t found = 0;
+  const double random_lookup = lookup(broker, names, originator, found);
+  const double ordered_lookup = lookup(broker, ordered, originator, found);
+
+  bm_timer timer;
+  for (std::size_t i = 0; i < lookup_count; ++i)
+    found += broker.has_preset_value(names[i % names.size()]);
+  const double preset = timer.ns_per(lookup_count);
+
+  std::size_t visited = 0;
+  timer.restart();
+  for (int k = 0; k < 10; ++k)
+    broker.for_each_param(cci::cci_param_visitor(counter(visited)),
+                          originator);
+  const double walk = timer.ns_per(visited);
+
+  std::printf("%-10s %12.1f %12.1f %12.1f %12.1f   (%lu found)\n", state,
+              random_lookup, ordered_lookup, preset, walk,
+              static_cast<unsigned long>(found));
+}
+
+}  // namespace
+
+/**
+ *  @fn     int sc_main(int argc, char* argv[])
+ *  @brief  Runs the benchmark
+ *  @param  argc  An integer for the number of input arguments
+ *  @param  argv  A list of the input arguments
+ *  @return An integer denoting the return status of execution.
+ */
+int sc_main(int argc, char *argv[]) {
+  cci_utils::broker* broker = new cci_utils::broker("My Global Broker");
+  cci::cci_register_broker(broker);
+  const cci::cci_originator originator("bm02");
+
+  std::vector<std::string> names(param_count);
+  std::vector<std::string> ordered;
+  for (std::size_t i = 0; i < param_count; ++i) {
+    char name[64];
+    std::sprintf(name, "top.cluster%lu.core%lu.param%lu",
+                 static_cast<unsigned long>(i % 100),
+                 static_cast<unsigned long>(i / 100 % 100),
+                 static_cast<unsigned long>(i / 10000));
+    names[i] = name;
+  }
+  ordered = names;
+  std::sort(ordered.begin(), ordered.end());
+  std::srand(1);
+  for (std::size_t i = param_count; i > 1; --i)
+    std::swap(names[i - 1], names[std::rand() % i]);
+
+  std::vector<cci::cci_param<int>*> params(param_count);
+  for (std::size_t i = 0; i < param_count; ++i) {
+    broker->set_preset_cci_value(names[i] + "_preset", cci::cci_value(1),
+                                 originator);
+    params[i] = new cci::cci_param<int>(names[i], 0, "",
+                                        cci::CCI_ABSOLUTE_NAME, originator);
+  }
+
+  std::printf("%-10s %12s %12s %12s %12s   (ns per operation)\n",
+              "broker", "get_handle", "(ordered)", "has_preset", "walk");
+  measure("mutable", *broker, names, ordered, originator);
+  broker->freeze();
+  measure("frozen", *broker, names, ordered, originator);
+
+  for (std::size_t i = 0; i < param_count; ++i)
+    delete params[i];
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   bm03_Value_Map.cpp
+ * @brief  Cost of building, copying, converting and destroying a large
+ *         cci_value map
+ * @author Accellera CCI Working Group
+ *
+ * Builds a map of 100k entries (hierarchical keys, integer values) and
+ * measures copying it, converting it to and from JSON, and destroying
+ * it.  Every map member and key string is a separate heap block, so this
+ * is mostly a measure of the allocator.
+ *
+ * The "arena" column performs the same operations on a cci_value_arena,
+ * which takes all nodes of the tree from a single region and releases it
+ * in bulk (an arena tree is filled by a copy or from JSON, not built
+ * entry by entry).
+ */
+
+#include <cci_configuration>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "bm_timer.h"
+
+namespace {
+const std::size_t entry_count = 100000;
+}  // namespace
+
+/**
+ *  @fn     int sc_main(int argc, char* argv[])
+ *  @brief  Runs the benchmark
+ *  @param  argc  An integer for the number of input arguments
+ *  @param  argv  A list of the input arguments
+ *  @return An integer denoting the return status of execution.
+ */
+int sc_main(int argc, char *argv[]) {
+  std::vector<std::string> keys(entry_count);
+  for (std::size_t i = 0; i < entry_count; ++i) {
+    char key[64];
+    std::sprintf(key, "top.cluster%lu.core%lu.param%lu",
+                 static_cast<unsigned long>(i % 100),
+                 static_cast<unsigned long>(i / 100 % 100),
+                 static_cast<unsigned long>(i / 10000));
+    keys[i] = key;
+  }
+
+  std::printf("%-12s %12s %12s   (ns per entry, %lu entries)\n", "operation",
+              "cci_value", "arena", static_cast<unsigned long>(entry_count));
+
+  bm_timer timer;
+  cci::cci_value* map = new cci::cci_value;
+  cci::cci_value_map_ref entries = map->set_map();
+  for (std::size_t i = 0; i < entry_count; ++i)
+    entries.push_entry(keys[i], cci::cci_value(static_cast<int>(i)));
+  std::printf("%-12s %12.1f %12s\n", "build", timer.ns_per(entry_count), "-");
+
+  timer.restart();
+  cci::cci_value* copy = new cci::cci_value(*map);
+  const double copy_time = timer.ns_per(entry_count);
+  cci::cci_value_arena* arena = new cci::cci_value_arena;
+  timer.restart();
+  arena->assign(*map);
+  std::printf("%-12s %12.1f %12.1f\n", "copy", copy_time,
+              timer.ns_per(entry_count));
+  bool same = (arena->get() == *copy);
+
+  timer.restart();
+  delete copy;
+  const double destroy_time = timer.ns_per(entry_count);
+  timer.restart();
+  delete arena;
+  std::printf("%-12s %12.1f %12.1f\n", "destroy", destroy_time,
+              timer.ns_per(entry_count));
+
+  timer.restart();
+  const std::string json = map->to_json();
+  const double to_json_time = timer.ns_per(entry_count);
+  cci::cci_value_arena json_arena;
+  json_arena.assign(*map);
+  timer.restart();
+  const std::string arena_json = json_arena.get().to_json();
+  std::printf("%-12s %12.1f %12.1f\n", "to_json", to_json_time,
+              timer.ns_per(entry_count));
+  same = same && arena_json == json;
+
+  timer.restart();
+  const cci::cci_value parsed = cci::cci_value::from_json(json);
+  const double from_json_time = timer.ns_per(entry_count);
+  timer.restart();
+  json_arena.from_json(json);
+  std::printf("%-12s %12.1f %12.1f\n", "from_json", from_json_time,
+              timer.ns_per(entry_count));
+
+  same = same && parsed == *map && json_arena.get() == *map;
+  delete map;
+  return same ? EXIT_SUCCESS : EXIT_FAILURE;
+}
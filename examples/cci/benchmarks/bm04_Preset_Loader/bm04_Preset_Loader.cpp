@@ -0,0 +1,167 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   bm04_Preset_Loader.cpp
+ * @brief  Throughput of cci_utils::preset_loader on a large configuration
+ * @author Accellera CCI Working Group
+ *
+ * Writes a line-oriented and a JSON configuration of 500 MB each (the size
+ * in MB may be given as the first argument) and loads both of them with
+ * cci_utils::preset_loader and with a naive loader, which reads the lines
+ * with std::getline and converts each value with cci_value::from_json
+ * (the whole document respectively).  The values are a mix of integers,
+ * short lists and strings.  The presets are created by an unmeasured load
+ * beforehand, so all measured loads replace existing presets.
+ */
+
+#include <cci_configuration>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "bm_timer.h"
+
+namespace {
+
+const char* const line_file = "bm04_presets.cfg";
+const char* const json_file = "bm04_presets.json";
+
+/// Writes both configurations, returns the number of presets
+std::size_t write_files(std::size_t megabytes) {
+  const std::string text(160, 'x');
+  std::FILE* lines = std::fopen(line_file, "w");
+  std::FILE* json = std::fopen(json_file, "w");
+  if (!lines || !json) {
+    std::perror("bm04");
+    std::exit(EXIT_FAILURE);
+  }
+
+  std::fputs("{\n", json);
+  std::size_t count = 0;
+  for (long written = 0;
+       static_cast<std::size_t>(written) < megabytes << 20; ++count) {
+    char name[64];
+    std::sprintf(name, "top.cluster%lu.core%lu.param%lu",
+                 static_cast<unsigned long>(count % 100),
+                 static_cast<unsigned long>(count / 100 % 100),
+                 static_cast<unsigned long>(count / 10000));
+    char value[256];
+    switch (count % 3) {
+    case 0:
+      std::sprintf(value, "%lu", static_cast<unsigned long>(count));
+      break;
+    case 1:
+      std::sprintf(value, "[%lu, 1, 2, 3, 4, 5, 6, 7]",
+                   static_cast<unsigned long>(count));
+      break;
+    default:
+      std::sprintf(value, "\"%s%lu\"", text.c_str(),
+                   static_cast<unsigned long>(count));
+    }
+    std::fprintf(lines, "%s %s\n", name, value);
+    std::fprintf(json, "%s  \"%s\": %s", count ? ",\n" : "", name, value);
+    written = std::ftell(lines);
+  }
+  std::fputs("\n}\n", json);
+  std::fclose(lines);
+  std::fclose(json);
+  return count;
+}
+
+/// Loads the line-oriented configuration line by line
+std::size_t naive_lines(cci::cci_broker_handle broker) {
+  std::ifstream in(line_file);
+  std::string line;
+  std::size_t count = 0;
+  while (std::getline(in, line)) {
+    const std::string::size_type blank = line.find(' ');
+    broker.set_preset_cci_value(
+        line.substr(0, blank),
+        cci::cci_value::from_json(line.substr(blank + 1)));
+    ++count;
+  }
+  return count;
+}
+
+/// Loads the JSON configuration as a whole document
+std::size_t naive_json(cci::cci_broker_handle broker) {
+  std::ifstream in(json_file);
+  const std::string text((std::istreambuf_iterator<char>(in)),
+                         std::istreambuf_iterator<char>());
+  const cci::cci_value presets = cci::cci_value::from_json(text);
+  cci::cci_value::const_map_reference map = presets.get_map();
+  for (cci::cci_value::const_map_reference::const_iterator it = map.cbegin();
+       it != map.cend(); ++it)
+    broker.set_preset_cci_value(it->key, it->value);
+  return map.size();
+}
+
+/// Prints the time and throughput of a load
+void report(const char* format, const char* loader, std::size_t presets,
+            std::size_t megabytes, double seconds) {
+  std::printf("%-6s %-14s %10.2f %10.1f %10.1f\n", format, loader, seconds,
+              megabytes / seconds, seconds * 1e9 / presets);
+}
+
+}  // namespace
+
+/**
+ *  @fn     int sc_main(int argc, char* argv[])
+ *  @brief  Runs the benchmark
+ *  @param  argc  An integer for the number of input arguments
+ *  @param  argv  A list of the input arguments
+ *  @return An integer denoting the return status of execution.
+ */
+int sc_main(int argc, char *argv[]) {
+  cci::cci_register_broker(new cci_utils::broker("My Global Broker"));
+  cci::cci_broker_handle broker =
+      cci::cci_get_global_broker(cci::cci_originator("bm04"));
+
+  const std::size_t megabytes = argc > 1 ? std::atoi(argv[1]) : 500;
+  const std::size_t presets = write_files(megabytes);
+  std::printf("%lu MB, %lu presets per file\n",
+              static_cast<unsigned long>(megabytes),
+              static_cast<unsigned long>(presets));
+  std::printf("%-6s %-14s %10s %10s %10s\n", "format", "loader", "seconds",
+              "MB/s", "ns/preset");
+
+  // create the presets first, all measured loads replace existing presets
+  cci_utils::preset_loader loader(broker);
+  bool ok = loader.load_file(line_file) == presets;
+
+  bm_timer timer;
+  ok &= loader.load_file(line_file) == presets;
+  report("lines", "preset_loader", presets, megabytes, timer.seconds());
+  timer.restart();
+  ok &= naive_lines(broker) == presets;
+  report("lines", "getline", presets, megabytes, timer.seconds());
+
+  timer.restart();
+  ok &= loader.load_file(json_file) == presets;
+  report("json", "preset_loader", presets, megabytes, timer.seconds());
+  timer.restart();
+  ok &= naive_json(broker) == presets;
+  report("json", "document", presets, megabytes, timer.seconds());
+
+  std::remove(line_file);
+  std::remove(json_file);
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,197 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   bm05_Callback_Dispatch.cpp
+ * @brief  Cost of dispatching parameter callbacks, typed and untyped
+ * @author Accellera CCI Working Group
+ *
+ * Writes and reads a parameter with a growing number of typed or untyped
+ * post write (pre read respectively) callbacks registered, and reports
+ * the cost per callback invocation, the cost of the access without any
+ * callback subtracted.
+ *
+ * Next to each column, the "before" column reports the cost of the
+ * previous dispatch, which created the typed callback handle (adapting
+ * untyped callbacks) and the parameter handle of the event for every
+ * callback invocation, and converted the values passed to untyped
+ * callbacks whether they were accessed or not.  It is emulated by
+ * dispatching the same callbacks outside of the parameter.
+ */
+
+#include <cci_configuration>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "bm_timer.h"
+
+namespace {
+
+const std::size_t access_count = 1000000;
+
+/// Counts the callback invocations
+struct observer {
+  observer() : count(0) {}
+  void post_write(const cci::cci_param_write_event<int>&) { ++count; }
+  void post_write_untyped(const cci::cci_param_write_event<>&) { ++count; }
+  void pre_read(const cci::cci_param_read_event<int>&) { ++count; }
+  void pre_read_untyped(const cci::cci_param_read_event<>&) { ++count; }
+  std::size_t count;
+};
+
+/// Time per write of the parameter
+double write(cci::cci_param<int>& param) {
+  bm_timer timer;
+  for (std::size_t i = 0; i < access_count; ++i)
+    param = static_cast<int>(i);
+  return timer.ns_per(access_count);
+}
+
+/// Time per read of the parameter
+double read(const cci::cci_param<int>& param, int& sum) {
+  bm_timer timer;
+  for (std::size_t i = 0; i < access_count; ++i)
+    sum += param.get_value();
+  return timer.ns_per(access_count);
+}
+
+/// Time per callback of a post write dispatch, building the handles per event
+double legacy_write(const cci::cci_param<int>& param,
+                    const std::vector<cci::cci_callback_untyped_handle>& cbs,
+                    const cci::cci_originator& originator, bool untyped) {
+  const std::size_t events = access_count / cbs.size();
+  bm_timer timer;
+  for (std::size_t i = 0; i < events; ++i) {
+    const int old_value = static_cast<int>(i);
+    const int new_value = old_value + 1;
+    for (std::size_t j = 0; j < cbs.size(); ++j) {
+      const cci::cci_param_post_write_callback_handle<int> cb(cbs[j]);
+      if (cb.valid()) {
+        const cci::cci_param_untyped_handle handle =
+            param.create_param_handle(originator);
+        const cci::cci_param_write_event<int>
+            ev(old_value, new_value, originator, handle);
+        if (untyped) {  // values converted for each untyped callback
+          const cci::cci_value old_cci_value(old_value);
+          const cci::cci_value new_cci_value(new_value);
+        }
+        cb.invoke(ev);
+      }
+    }
+  }
+  return timer.ns_per(events * cbs.size());
+}
+
+/// Time per callback of a pre read dispatch, building the handles per event
+double legacy_read(const cci::cci_param<int>& param,
+                   const std::vector<cci::cci_callback_untyped_handle>& cbs,
+                   const cci::cci_originator& originator, bool untyped) {
+  const std::size_t events = access_count / cbs.size();
+  bm_timer timer;
+  for (std::size_t i = 0; i < events; ++i) {
+    const int value = static_cast<int>(i);
+    for (std::size_t j = 0; j < cbs.size(); ++j) {
+      const cci::cci_param_pre_read_callback_handle<int> cb(cbs[j]);
+      if (cb.valid()) {
+        const cci::cci_param_untyped_handle handle =
+            param.create_param_handle(originator);
+        const cci::cci_param_read_event<int> ev(value, originator, handle);
+        if (untyped) {  // value converted for each untyped callback
+          const cci::cci_value cci_value(value);
+        }
+        cb.invoke(ev);
+      }
+    }
+  }
+  return timer.ns_per(events * cbs.size());
+}
+
+}  // namespace
+
+/**
+ *  @fn     int sc_main(int argc, char* argv[])
+ *  @brief  Runs the benchmark
+ *  @param  argc  An integer for the number of input arguments
+ *  @param  argv  A list of the input arguments
+ *  @return An integer denoting the return status of execution.
+ */
+int sc_main(int argc, char *argv[]) {
+  cci::cci_register_broker(new cci_utils::broker("My Global Broker"));
+  const cci::cci_originator originator("bm05");
+
+  std::printf("%10s %9s %9s %9s %9s %9s %9s %9s %9s   (ns per callback)\n",
+              "callbacks", "write", "(before)", "untyped", "(before)",
+              "read", "(before)", "untyped", "(before)");
+
+  int sum = 0;
+  for (std::size_t callbacks = 1; callbacks <= 64; callbacks *= 4) {
+    double cost[4], before[4];
+    std::size_t invoked = 0, legacy_invoked = 0;
+    for (int untyped = 0; untyped < 2; ++untyped) {
+      cci::cci_param<int> param("top.param", 0, "", cci::CCI_ABSOLUTE_NAME,
+                                originator);
+      const double plain_write = write(param);
+      const double plain_read = read(param, sum);
+
+      observer obs;
+      for (std::size_t i = 0; i < callbacks; ++i) {
+        if (untyped) {
+          param.register_post_write_callback(
+              &observer::post_write_untyped, &obs, cci::cci_untyped_tag());
+          param.register_pre_read_callback(
+              &observer::pre_read_untyped, &obs, cci::cci_untyped_tag());
+        } else {
+          param.register_post_write_callback(&observer::post_write, &obs);
+          param.register_pre_read_callback(&observer::pre_read, &obs);
+        }
+      }
+      cost[untyped] = (write(param) - plain_write) / callbacks;
+      cost[2 + untyped] = (read(param, sum) - plain_read) / callbacks;
+      invoked += obs.count;
+
+      // the same callbacks, dispatched the previous way
+      observer legacy;
+      std::vector<cci::cci_callback_untyped_handle> writes, reads;
+      for (std::size_t i = 0; i < callbacks; ++i) {
+        if (untyped) {
+          writes.push_back(cci::cci_param_post_write_callback_untyped(
+              sc_bind(&observer::post_write_untyped, &legacy, sc_unnamed::_1)));
+          reads.push_back(cci::cci_param_pre_read_callback_untyped(
+              sc_bind(&observer::pre_read_untyped, &legacy, sc_unnamed::_1)));
+        } else {
+          writes.push_back(cci::cci_param_post_write_callback<int>(
+              sc_bind(&observer::post_write, &legacy, sc_unnamed::_1)));
+          reads.push_back(cci::cci_param_pre_read_callback<int>(
+              sc_bind(&observer::pre_read, &legacy, sc_unnamed::_1)));
+        }
+      }
+      before[untyped] = legacy_write(param, writes, originator, untyped);
+      before[2 + untyped] = legacy_read(param, reads, originator, untyped);
+      legacy_invoked += legacy.count;
+    }
+    std::printf("%10lu %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f\n",
+                static_cast<unsigned long>(callbacks),
+                cost[0], before[0], cost[1], before[1],
+                cost[2], before[2], cost[3], before[3]);
+    if (invoked != 4 * callbacks * access_count
+        || legacy_invoked != 4 * callbacks * (access_count / callbacks))
+      return EXIT_FAILURE;
+  }
+  return sum == 42 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,114 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   bm06_Deep_Hierarchy.cpp
+ * @brief  Broker resolution and parameter construction in a deep hierarchy
+ * @author Accellera CCI Working Group
+ *
+ * Builds a binary tree of modules, 10 levels deep, whose 512 leaf modules
+ * create 196 parameters each (100352 in total).  Each leaf also looks up
+ * its broker via cci::cci_get_broker() repeatedly.  The only broker is the
+ * global one, so each uncached resolution walks up to the root.
+ */
+
+#include <cci_configuration>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "bm_timer.h"
+
+namespace {
+
+const int depth = 10;
+const std::size_t params_per_leaf = 196;
+const std::size_t lookups_per_leaf = 2000;
+
+double lookup_seconds = 0;
+double param_seconds = 0;
+std::size_t param_count = 0;
+std::size_t lookup_count = 0;
+
+/// Module of the tree, leaves (at the given depth) hold the parameters
+struct node : public sc_core::sc_module {
+  node(sc_core::sc_module_name name, int level)
+      : sc_core::sc_module(name) {
+    if (level < depth) {
+      children.push_back(new node("left", level + 1));
+      children.push_back(new node("right", level + 1));
+      return;
+    }
+
+    bm_timer timer;
+    std::size_t valid = 0;
+    for (std::size_t i = 0; i < lookups_per_leaf; ++i)
+      valid += cci::cci_get_broker().is_global_broker();
+    lookup_seconds += timer.seconds();
+    lookup_count += valid;
+
+    timer.restart();
+    for (std::size_t i = 0; i < params_per_leaf; ++i) {
+      char param_name[16];
+      std::sprintf(param_name, "p%lu", static_cast<unsigned long>(i));
+      params.push_back(new cci::cci_param<int>(param_name, 0));
+    }
+    param_seconds += timer.seconds();
+    param_count += params.size();
+  }
+
+  ~node() {
+    for (std::size_t i = 0; i < params.size(); ++i)
+      delete params[i];
+    for (std::size_t i = 0; i < children.size(); ++i)
+      delete children[i];
+  }
+
+  std::vector<node*> children;
+  std::vector<cci::cci_param<int>*> params;
+};
+
+}  // namespace
+
+/**
+ *  @fn     int sc_main(int argc, char* argv[])
+ *  @brief  Runs the benchmark
+ *  @param  argc  An integer for the number of input arguments
+ *  @param  argv  A list of the input arguments
+ *  @return An integer denoting the return status of execution.
+ */
+int sc_main(int argc, char *argv[]) {
+  cci::cci_register_broker(new cci_utils::broker("My Global Broker"));
+
+  bm_timer timer;
+  node* root = new node("top", 1);
+  const double elaboration = timer.seconds();
+
+  std::printf("%d levels, %lu parameters\n", depth,
+              static_cast<unsigned long>(param_count));
+  std::printf("%-16s %10.1f ns per call\n", "cci_get_broker",
+              lookup_seconds * 1e9 / lookup_count);
+  std::printf("%-16s %10.1f ns per parameter\n", "cci_param",
+              param_seconds * 1e9 / param_count);
+  std::printf("%-16s %10.3f s\n", "elaboration", elaboration);
+
+  timer.restart();
+  delete root;
+  std::printf("%-16s %10.3f s\n", "teardown", timer.seconds());
+  return EXIT_SUCCESS;
+}
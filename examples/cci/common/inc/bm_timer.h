@@ -0,0 +1,59 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   bm_timer.h
+ * @brief  Wall clock timing for the CCI benchmarks
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_COMMON_BM_TIMER_H_
+#define EXAMPLES_COMMON_BM_TIMER_H_
+
+#include <chrono>
+#include <cstddef>
+
+/**
+ *  @class  bm_timer
+ *  @brief  Measures the wall clock time since its construction (or the
+ *          latest restart)
+ */
+class bm_timer {
+ public:
+  bm_timer() : m_start(clock::now()) {}
+
+  /// Restart the measurement
+  void restart() { m_start = clock::now(); }
+
+  /// Elapsed time in seconds
+  double seconds() const {
+    return std::chrono::duration<double>(clock::now() - m_start).count();
+  }
+
+  /// Elapsed time in nanoseconds per operation
+  double ns_per(std::size_t ops) const {
+    return ops ? seconds() * 1e9 / ops : 0.0;
+  }
+
+ private:
+  typedef std::chrono::steady_clock clock;
+  clock::time_point m_start;
+};
+
+#endif  // EXAMPLES_COMMON_BM_TIMER_H_
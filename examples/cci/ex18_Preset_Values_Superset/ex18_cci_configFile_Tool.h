@@ -132,14 +132,18 @@ class ex18_cci_configFile_Tool {
     gs::cnf::ex18_ConfigSet cnf_set;
     cnf_set = create_config_set_from_file(filename);
 
+    std::vector<cci::cci_name_value_pair> presets;
+    presets.reserve(cnf_set.get_config_map().size());
+
     gs::cnf::ex18_ConfigSet::cnf_data_map_type::const_iterator it;
     for (it = cnf_set.get_config_map().begin();
          it != cnf_set.get_config_map().end(); it++) {
       std::cout << "ConfigFile_Api: Applying preset value of param '"
                 << it->first << "' to '" << it->second << "'" << std::endl;
-      m_broker.set_preset_cci_value(it->first.c_str(),
-                                  cci::cci_value::from_json(it->second.c_str()));
+      presets.push_back(std::make_pair(it->first,
+                          cci::cci_value::from_json(it->second.c_str())));
     }
+    m_broker.set_preset_cci_values(presets);
   }
 
   /**
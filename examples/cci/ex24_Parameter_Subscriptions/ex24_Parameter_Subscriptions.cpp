@@ -0,0 +1,92 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex24_Parameter_Subscriptions.cpp
+ * @brief  Observing the parameters of a whole subsystem
+ * @author Accellera CCI Working Group
+ */
+
+#include <cci_configuration>
+#include "ex24_core.h"
+#include "ex24_observer.h"
+
+/**
+ *  @class  ex24_subsystem
+ *  @brief  A subsystem with a private broker, exposing the clock frequencies
+ *          of its cores only
+ */
+SC_MODULE(ex24_subsystem) {
+ public:
+  /**
+   *  @fn     ex24_subsystem
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex24_subsystem)
+      : m_broker("Subsystem Broker")
+  {
+    m_broker.expose_pattern("sys.*.clock_mhz");
+    cci::cci_register_broker(m_broker);
+
+    m_observer = new ex24_observer("observer");
+    m_core0 = new ex24_core("core0", 100, sc_core::sc_time(10, sc_core::SC_NS));
+    m_core1 = new ex24_core("core1", 200, sc_core::sc_time(12, sc_core::SC_NS));
+  }
+
+  ~ex24_subsystem() {
+    delete m_core1;
+    delete m_core0;
+    delete m_observer;
+  }
+
+ private:
+  cci_utils::broker m_broker;  ///< Private broker of the subsystem
+  ex24_observer* m_observer;   ///< Observer of the subsystem parameters
+  ex24_core* m_core0;          ///< First core
+  ex24_core* m_core1;          ///< Second core
+};
+
+/**
+ *  @fn     int sc_main(int argc, char* argv[])
+ *  @brief  The testbench for the CCI parameter subscriptions example
+ *  @param  argc  An integer for the number of input arguments
+ *  @param  argv  A list of the input arguments
+ *  @return An integer denoting the return status of execution.
+ */
+int sc_main(int argc, char *argv[]) {
+  cci::cci_register_broker(new cci_utils::broker("My Global Broker"));
+
+  ex24_subsystem sys("sys");
+
+  SC_REPORT_INFO("sc_main", "Begin Simulation.");
+  sc_core::sc_start();
+  SC_REPORT_INFO("sc_main", "End Simulation.");
+
+  // The exposed parameters have been registered with the global broker
+  cci::cci_broker_handle global =
+    cci::cci_get_global_broker(cci::cci_originator("sc_main"));
+  std::vector<cci::cci_param_untyped_handle> exposed =
+    global.get_param_handles();
+  for (std::size_t i = 0; i < exposed.size(); ++i)
+    std::cout << exposed[i].name() << " = "
+              << exposed[i].get_cci_value() << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,81 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex24_core.h
+ * @brief  A core owning two parameters
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX24_PARAMETER_SUBSCRIPTIONS_EX24_CORE_H_
+#define EXAMPLES_EX24_PARAMETER_SUBSCRIPTIONS_EX24_CORE_H_
+
+#include <cci_configuration>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex24_core
+ *  @brief  The core owns a clock frequency and a cache size parameter and
+ *          updates both during the simulation
+ */
+SC_MODULE(ex24_core) {
+ public:
+  SC_HAS_PROCESS(ex24_core);
+
+  /**
+   *  @fn     ex24_core(sc_core::sc_module_name _name, int clock_mhz, const sc_core::sc_time& delay)
+   *  @brief  The class constructor
+   *  @param  _name     The name of the core
+   *  @param  clock_mhz The default clock frequency
+   *  @param  delay     Delay of the parameter updates
+   *  @return void
+   */
+  ex24_core(sc_core::sc_module_name _name, int clock_mhz,
+            const sc_core::sc_time& delay)
+      : sc_core::sc_module(_name),
+        clock_mhz("clock_mhz", clock_mhz),
+        cache_kb("cache_kb", 32),
+        m_delay(delay)
+  {
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Updates the parameters of the core
+   *  @return void
+   */
+  void run() {
+    wait(m_delay);
+    XREPORT("run: Doubling the clock frequency");
+    clock_mhz = 2 * clock_mhz;
+
+    wait(m_delay);
+    XREPORT("run: Setting the cache size to 64 KiB");
+    cache_kb = 64;
+  }
+
+ private:
+  cci::cci_param<int> clock_mhz; ///< Clock frequency (exposed)
+  cci::cci_param<int> cache_kb;  ///< Cache size (private)
+  sc_core::sc_time m_delay;      ///< Delay of the parameter updates
+};
+// ex24_core
+
+#endif  // EXAMPLES_EX24_PARAMETER_SUBSCRIPTIONS_EX24_CORE_H_
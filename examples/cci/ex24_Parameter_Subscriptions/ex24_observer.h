@@ -0,0 +1,121 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex24_observer.h
+ * @brief  Observe the parameters of a subsystem with broker subscriptions
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX24_PARAMETER_SUBSCRIPTIONS_EX24_OBSERVER_H_
+#define EXAMPLES_EX24_PARAMETER_SUBSCRIPTIONS_EX24_OBSERVER_H_
+
+#include <cci_configuration>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex24_observer
+ *  @brief  The observer registers two subscriptions with its broker instead
+ *          of registering callbacks on each parameter:
+ *          - a post-write subscription tracing all parameters of the
+ *            subsystem, including the parameters created later on, and
+ *          - a pre-write subscription rejecting cache sizes, which are not
+ *            a power of two.
+ */
+SC_MODULE(ex24_observer) {
+ public:
+  /**
+   *  @fn     ex24_observer
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex24_observer)
+      : m_broker(cci::cci_get_broker())
+  {
+    // The subsystem has a private broker, the subscriptions are passed up
+    // the broker stack and cover the exposed parameters as well
+    m_trace = m_broker.register_post_write_subscription("sys.**",
+      cci::cci_param_post_write_callback_untyped(
+        sc_bind(&ex24_observer::trace_write, this, sc_unnamed::_1)));
+    m_check = m_broker.register_pre_write_subscription("sys.*.cache_kb",
+      cci::cci_param_pre_write_callback_untyped(
+        sc_bind(&ex24_observer::check_cache_size, this, sc_unnamed::_1)));
+
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     void trace_write(const cci::cci_param_write_event<> & ev)
+   *  @brief  Post-write subscription
+   *  @param  ev The write event
+   *  @return void
+   */
+  void trace_write(const cci::cci_param_write_event<> & ev) {
+    XREPORT("[TRACE] " << ev.param_handle.name() << " : "
+            << ev.old_value << " -> " << ev.new_value);
+  }
+
+  /**
+   *  @fn     bool check_cache_size(const cci::cci_param_write_event<> & ev)
+   *  @brief  Pre-write subscription
+   *  @param  ev The write event
+   *  @return false to reject the new value
+   */
+  bool check_cache_size(const cci::cci_param_write_event<> & ev) {
+    const int kb = ev.new_value.get_int();
+    if (kb > 0 && (kb & (kb - 1)) == 0)
+      return true;
+    XREPORT("[CHECK] " << ev.param_handle.name() << " : rejecting "
+            << ev.new_value);
+    return false;
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Writes the parameters from the outside and finally removes
+   *          the trace subscription
+   *  @return void
+   */
+  void run() {
+    wait(5.0, sc_core::SC_NS);
+    cci::cci_param_handle cache = m_broker.get_param_handle("sys.core1.cache_kb");
+    XREPORT("run: Setting " << cache.name() << " to 48");
+    try {
+      cache.set_cci_value(cci::cci_value(48));
+    } catch (sc_core::sc_report const &) {
+      cci::cci_handle_exception(cci::CCI_SET_PARAM_FAILURE);
+      XREPORT("run: The value has been rejected, "
+              << cache.name() << " = " << cache.get_cci_value());
+    }
+    XREPORT("run: Setting " << cache.name() << " to 16");
+    cache.set_cci_value(cci::cci_value(16));
+
+    wait(10.0, sc_core::SC_NS);
+    XREPORT("run: Removing the trace subscription");
+    m_broker.unregister_subscription(m_trace);
+  }
+
+ private:
+  cci::cci_broker_handle m_broker;      ///< Broker of the subsystem
+  cci::cci_callback_untyped_handle m_trace; ///< Trace subscription
+  cci::cci_callback_untyped_handle m_check; ///< Cache size check
+};
+// ex24_observer
+
+#endif  // EXAMPLES_EX24_PARAMETER_SUBSCRIPTIONS_EX24_OBSERVER_H_
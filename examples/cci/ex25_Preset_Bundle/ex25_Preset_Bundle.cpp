@@ -0,0 +1,114 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex25_Preset_Bundle.cpp
+ * @brief  Writing a preset bundle and configuring a model from it
+ * @author Accellera CCI Working Group
+ */
+
+#include <cci_configuration>
+#include <fstream>
+#include <iterator>
+#include "ex25_cpu.h"
+
+/**
+ *  @fn     void write_bundle(const std::string& filename)
+ *  @brief  Compiles the preset values of the platform into a bundle
+ *  @param  filename The name of the bundle file
+ *  @return void
+ */
+void write_bundle(const std::string& filename) {
+  const cci::cci_originator tool("bundle_tool");
+
+  cci_utils::preset_bundle::builder builder;
+  builder.add("cpu.clock_mhz", cci::cci_value(800), tool);
+  builder.add("cpu.isa", cci::cci_value("armv8"), tool);
+  builder.add("cpu.trace", cci::cci_value(true), tool);
+  builder.add("cpu.l2_kb", cci::cci_value(512), tool);
+  builder.add("gpu.shaders",
+              cci::cci_value::from_json("{\"count\":16,\"simd\":32}"), tool);
+  builder.write(filename);
+
+  std::cout << "Bundle '" << filename << "' written ("
+            << builder.size() << " presets)" << std::endl;
+}
+
+/**
+ *  @fn     void check_truncated_bundle(const std::string& filename)
+ *  @brief  Opens a truncated copy of a bundle, which is rejected
+ *  @param  filename The name of the (valid) bundle file
+ *  @return void
+ */
+void check_truncated_bundle(const std::string& filename) {
+  std::ifstream is(filename.c_str(), std::ios::binary);
+  std::string contents((std::istreambuf_iterator<char>(is)),
+                       std::istreambuf_iterator<char>());
+  const std::string truncated = "ex25_truncated.bundle";
+  std::ofstream(truncated.c_str(), std::ios::binary)
+    .write(contents.data(), contents.size() / 2);
+
+  try {
+    cci_utils::preset_bundle bundle(truncated);
+  } catch (sc_core::sc_report const &) {
+    std::cout << "Bundle '" << truncated << "' rejected" << std::endl;
+  }
+}
+
+/**
+ *  @fn     int sc_main(int argc, char* argv[])
+ *  @brief  The testbench for the CCI preset bundle example
+ *  @param  argc  An integer for the number of input arguments
+ *  @param  argv  A list of the input arguments
+ *  @return An integer denoting the return status of execution.
+ */
+int sc_main(int argc, char *argv[]) {
+  const std::string filename = "ex25_presets.bundle";
+  write_bundle(filename);
+  check_truncated_bundle(filename);
+
+  cci_utils::broker* global_broker = new cci_utils::broker("My Global Broker");
+  cci::cci_register_broker(global_broker);
+
+  std::shared_ptr<const cci_utils::preset_bundle> bundle =
+    std::make_shared<cci_utils::preset_bundle>(filename);
+  std::cout << "Bundle '" << filename << "' opened ("
+            << bundle->size() << " presets)" << std::endl;
+  global_broker->set_preset_bundle(bundle);
+
+  // Preset values set on the broker take precedence over the bundle
+  cci::cci_broker_handle broker =
+    cci::cci_get_global_broker(cci::cci_originator("sc_main"));
+  broker.set_preset_cci_value("cpu.isa", cci::cci_value("riscv"));
+
+  ex25_cpu cpu("cpu");
+
+  SC_REPORT_INFO("sc_main", "Begin Simulation.");
+  sc_core::sc_start();
+  SC_REPORT_INFO("sc_main", "End Simulation.");
+
+  // Bundled presets without a parameter are reported as unconsumed
+  std::vector<cci::cci_name_value_pair> unconsumed =
+    broker.get_unconsumed_preset_values();
+  for (std::size_t i = 0; i < unconsumed.size(); ++i)
+    std::cout << "Unconsumed preset " << unconsumed[i].first << " = "
+              << unconsumed[i].second << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex25_cpu.h
+ * @brief  A processor configured from a preset bundle
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX25_PRESET_BUNDLE_EX25_CPU_H_
+#define EXAMPLES_EX25_PRESET_BUNDLE_EX25_CPU_H_
+
+#include <cci_configuration>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex25_cpu
+ *  @brief  The processor owns three parameters, which get their preset
+ *          values from the bundle (or a preset set by the testbench)
+ */
+SC_MODULE(ex25_cpu) {
+ public:
+  /**
+   *  @fn     ex25_cpu
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex25_cpu)
+      : clock_mhz("clock_mhz", 100),
+        isa("isa", "none"),
+        trace("trace", false)
+  {
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Reports the configuration of the processor
+   *  @return void
+   */
+  void run() {
+    XREPORT("run: clock_mhz = " << clock_mhz
+            << " (set by " << clock_mhz.get_value_origin().name() << ")");
+    XREPORT("run: isa = " << isa.get_value()
+            << " (set by " << isa.get_value_origin().name() << ")");
+    XREPORT("run: trace = " << std::boolalpha << trace.get_value()
+            << " (set by " << trace.get_value_origin().name() << ")");
+  }
+
+ private:
+  cci::cci_param<int> clock_mhz;   ///< Clock frequency
+  cci::cci_param<std::string> isa; ///< Instruction set
+  cci::cci_param<bool> trace;      ///< Instruction tracing
+};
+// ex25_cpu
+
+#endif  // EXAMPLES_EX25_PRESET_BUNDLE_EX25_CPU_H_
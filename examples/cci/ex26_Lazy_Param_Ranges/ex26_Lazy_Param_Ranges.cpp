@@ -0,0 +1,51 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex26_Lazy_Param_Ranges.cpp
+ * @brief  Selecting parameters through lazy parameter ranges
+ * @author Accellera CCI Working Group
+ */
+
+#include <cci_configuration>
+#include "ex26_cache.h"
+#include "ex26_scanner.h"
+
+/**
+ *  @fn     int sc_main(int argc, char* argv[])
+ *  @brief  The testbench for the CCI lazy parameter ranges example
+ *  @param  argc  An integer for the number of input arguments
+ *  @param  argv  A list of the input arguments
+ *  @return An integer denoting the return status of execution.
+ */
+int sc_main(int argc, char *argv[]) {
+  cci_utils::broker* global_broker = new cci_utils::broker("My Global Broker");
+  global_broker->set_lazy_param_ranges();
+  cci::cci_register_broker(global_broker);
+
+  ex26_cpu cpu0("cpu0");
+  ex26_cpu cpu1("cpu1");
+  ex26_scanner scanner("scanner");
+
+  SC_REPORT_INFO("sc_main", "Begin Simulation.");
+  sc_core::sc_start();
+  SC_REPORT_INFO("sc_main", "End Simulation.");
+
+  return EXIT_SUCCESS;
+}
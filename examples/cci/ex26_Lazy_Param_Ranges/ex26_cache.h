@@ -0,0 +1,80 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex26_cache.h
+ * @brief  A cache and a processor, owning a few parameters each
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX26_LAZY_PARAM_RANGES_EX26_CACHE_H_
+#define EXAMPLES_EX26_LAZY_PARAM_RANGES_EX26_CACHE_H_
+
+#include <cci_configuration>
+
+/**
+ *  @class  ex26_cache
+ *  @brief  The cache owns its size and associativity parameters
+ */
+SC_MODULE(ex26_cache) {
+ public:
+  /**
+   *  @fn     ex26_cache(sc_core::sc_module_name _name, int size_kb)
+   *  @brief  The class constructor
+   *  @param  _name   The name of the cache
+   *  @param  size_kb The default cache size
+   *  @return void
+   */
+  ex26_cache(sc_core::sc_module_name _name, int size_kb)
+      : sc_core::sc_module(_name),
+        size_kb("size_kb", size_kb),
+        ways("ways", 4)
+  {}
+
+ private:
+  cci::cci_param<int> size_kb; ///< Cache size
+  cci::cci_param<int> ways;    ///< Associativity
+};
+// ex26_cache
+
+/**
+ *  @class  ex26_cpu
+ *  @brief  The processor owns a clock frequency parameter and two caches
+ */
+SC_MODULE(ex26_cpu) {
+ public:
+  /**
+   *  @fn     ex26_cpu
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex26_cpu)
+      : clock_mhz("clock_mhz", 1000),
+        l1i("l1i", 32),
+        l1d("l1d", 64)
+  {}
+
+ private:
+  cci::cci_param<int> clock_mhz; ///< Clock frequency
+  ex26_cache l1i;                ///< Instruction cache
+  ex26_cache l1d;                ///< Data cache
+};
+// ex26_cpu
+
+#endif  // EXAMPLES_EX26_LAZY_PARAM_RANGES_EX26_CACHE_H_
@@ -0,0 +1,97 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex26_scanner.h
+ * @brief  Iterating over the parameters of a system with lazy ranges
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX26_LAZY_PARAM_RANGES_EX26_SCANNER_H_
+#define EXAMPLES_EX26_LAZY_PARAM_RANGES_EX26_SCANNER_H_
+
+#include <cci_configuration>
+#include <cstring>
+#include <vector>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex26_scanner
+ *  @brief  The scanner selects parameters with a predicate and keeps
+ *          handles of the selected parameters
+ */
+SC_MODULE(ex26_scanner) {
+ public:
+  /**
+   *  @fn     ex26_scanner
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex26_scanner)
+      : m_broker(cci::cci_get_broker())
+  {
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     bool is_cache_size(const cci::cci_param_untyped_handle& handle)
+   *  @brief  Predicate selecting the cache size parameters
+   *  @param  handle The handle of the parameter to check
+   *  @return true, if the parameter is a cache size
+   */
+  static bool is_cache_size(const cci::cci_param_untyped_handle& handle) {
+    const char* name = handle.name();
+    const std::size_t length = std::strlen(name);
+    return length > 8 && std::strcmp(name + length - 8, ".size_kb") == 0;
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Lists the cache sizes and doubles them via the kept handles
+   *  @return void
+   */
+  void run() {
+    // The range refers to the parameters; while iterating, the predicate
+    // and the loop body access them through a single cursor handle
+    cci::cci_param_predicate pred(&ex26_scanner::is_cache_size);
+    cci::cci_param_range caches = m_broker.get_param_handles(pred);
+
+    std::vector<cci::cci_param_untyped_handle> selected;
+    for (cci::cci_param_range::iterator it = caches.begin();
+         it != caches.end(); ++it) {
+      XREPORT("run: " << it->name() << " = " << it->get_cci_value());
+      // copying the handle registers it with the parameter
+      selected.push_back(*it);
+    }
+
+    wait(10, sc_core::SC_NS);
+    for (std::size_t i = 0; i < selected.size(); ++i) {
+      selected[i].set_cci_value(
+        cci::cci_value(2 * selected[i].get_cci_value().get_int()));
+      XREPORT("run: Doubled " << selected[i].name() << " to "
+              << selected[i].get_cci_value());
+    }
+  }
+
+ private:
+  cci::cci_broker_handle m_broker; ///< Broker handle
+};
+// ex26_scanner
+
+#endif  // EXAMPLES_EX26_LAZY_PARAM_RANGES_EX26_SCANNER_H_
@@ -0,0 +1,87 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex27_clock.h
+ * @brief  A clock generator with two dependent parameters
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX27_WRITE_BATCH_EX27_CLOCK_H_
+#define EXAMPLES_EX27_WRITE_BATCH_EX27_CLOCK_H_
+
+#include <cci_configuration>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex27_clock
+ *  @brief  The clock output frequency depends on the reference frequency
+ *          and the divider, the divider must not be zero
+ */
+SC_MODULE(ex27_clock) {
+ public:
+  /**
+   *  @fn     ex27_clock
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex27_clock)
+      : ref_mhz("ref_mhz", 800),
+        divider("divider", 4)
+  {
+    ref_mhz.register_post_write_callback(
+        &ex27_clock::post_write_callback, this);
+    divider.register_pre_write_callback(
+        &ex27_clock::check_divider, this);
+    divider.register_post_write_callback(
+        &ex27_clock::post_write_callback, this);
+  }
+
+  /**
+   *  @fn     bool check_divider(const cci::cci_param_write_event<int>& ev)
+   *  @brief  Pre write callback, rejecting a zero divider
+   *  @param  ev  The write event
+   *  @return false, to reject the write
+   */
+  bool check_divider(const cci::cci_param_write_event<int>& ev) {
+    if (ev.new_value == 0) {
+      XREPORT("[CLOCK check] : rejecting divider 0");
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   *  @fn     void post_write_callback(const cci::cci_param_write_event<int>& ev)
+   *  @brief  Post write callback, reporting the output frequency
+   *  @param  ev  The write event
+   *  @return void
+   */
+  void post_write_callback(const cci::cci_param_write_event<int>& ev) {
+    XREPORT("[CLOCK update] : " << ev.param_handle.name() << " = "
+            << ev.new_value << ", output " << ref_mhz / divider << " MHz");
+  }
+
+ private:
+  cci::cci_param<int> ref_mhz; ///< Reference frequency
+  cci::cci_param<int> divider; ///< Output divider
+};
+// ex27_clock
+
+#endif  // EXAMPLES_EX27_WRITE_BATCH_EX27_CLOCK_H_
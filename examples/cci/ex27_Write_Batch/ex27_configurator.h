@@ -0,0 +1,113 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex27_configurator.h
+ * @brief  Changing dependent parameters with write batches
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX27_WRITE_BATCH_EX27_CONFIGURATOR_H_
+#define EXAMPLES_EX27_WRITE_BATCH_EX27_CONFIGURATOR_H_
+
+#include <cci_configuration>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex27_configurator
+ *  @brief  The configurator changes the clock frequency with single writes
+ *          and with write batches
+ */
+SC_MODULE(ex27_configurator) {
+ public:
+  /**
+   *  @fn     ex27_configurator
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex27_configurator)
+      : m_broker(cci::cci_get_broker())
+  {
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     void commit(cci::cci_param_write_batch& batch)
+   *  @brief  Commits a batch, reporting the result
+   *  @param  batch The batch to commit
+   *  @return void
+   */
+  void commit(cci::cci_param_write_batch& batch) {
+    bool committed = false;
+    try {
+      committed = batch.commit();
+    } catch (sc_core::sc_report const &) {
+      cci::cci_handle_exception(cci::CCI_SET_PARAM_FAILURE);
+    }
+    XREPORT("run: Batch " << (committed ? "committed" : "rejected")
+            << ", output " << output_mhz() << " MHz");
+  }
+
+  /**
+   *  @fn     int output_mhz()
+   *  @brief  The output frequency of the clock
+   *  @return The output frequency
+   */
+  int output_mhz() {
+    return m_broker.get_param_handle("clk.ref_mhz").get_cci_value().get_int()
+         / m_broker.get_param_handle("clk.divider").get_cci_value().get_int();
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Reconfigures the clock
+   *  @return void
+   */
+  void run() {
+    cci::cci_param_handle ref_mhz = m_broker.get_param_handle("clk.ref_mhz");
+    cci::cci_param_handle divider = m_broker.get_param_handle("clk.divider");
+
+    // Single writes: the callbacks observe the intermediate 1600/4 MHz
+    wait(10, sc_core::SC_NS);
+    XREPORT("run: Setting 1600 MHz / 8 with single writes");
+    ref_mhz.set_cci_value(cci::cci_value(1600));
+    divider.set_cci_value(cci::cci_value(8));
+
+    // Batch: both values are written before the callbacks are invoked
+    wait(10, sc_core::SC_NS);
+    XREPORT("run: Setting 1500 MHz / 5 with a write batch");
+    cci::cci_param_write_batch batch = m_broker.create_write_batch();
+    batch.set_cci_value(ref_mhz, cci::cci_value(1500));
+    batch.set_cci_value(divider, cci::cci_value(5));
+    commit(batch);
+
+    // A rejected write leaves all parameters of the batch unmodified
+    wait(10, sc_core::SC_NS);
+    XREPORT("run: Setting 400 MHz / 0 with a write batch");
+    batch.set_cci_value("clk.ref_mhz", cci::cci_value(400));
+    batch.set_cci_value("clk.divider", cci::cci_value(0));
+    commit(batch);
+  }
+
+ private:
+  cci::cci_broker_handle m_broker; ///< Broker handle
+};
+// ex27_configurator
+
+#endif  // EXAMPLES_EX27_WRITE_BATCH_EX27_CONFIGURATOR_H_
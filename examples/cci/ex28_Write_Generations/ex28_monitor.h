@@ -0,0 +1,112 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex28_monitor.h
+ * @brief  A monitor polling for parameter changes
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX28_WRITE_GENERATIONS_EX28_MONITOR_H_
+#define EXAMPLES_EX28_WRITE_GENERATIONS_EX28_MONITOR_H_
+
+#include <cci_configuration>
+#include <vector>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex28_monitor
+ *  @brief  The monitor periodically reports the parameters written since
+ *          its previous poll, without registering any callbacks
+ */
+SC_MODULE(ex28_monitor) {
+ public:
+  /**
+   *  @fn     ex28_monitor
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex28_monitor)
+      : m_broker(cci::cci_get_broker()),
+        m_seen(0)
+  {
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     void poll()
+   *  @brief  Reports the parameters written since the previous poll
+   *  @return void
+   */
+  void poll() {
+    // sample the generation first, later writes are found by the next poll
+    cci::uint64 now = cci::cci_param_untyped::current_write_generation();
+    std::vector<cci::cci_param_untyped_handle> changed =
+        m_broker.get_changed_param_handles(m_seen);
+    m_seen = now;
+
+    if (changed.empty())
+      XREPORT("poll: no changes");
+    for (std::size_t i = 0; i < changed.size(); ++i) {
+      XREPORT("poll: " << changed[i].name() << " = "
+              << changed[i].get_cci_value().to_json());
+    }
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Polls for changes and reconfigures the timer
+   *  @return void
+   */
+  void run() {
+    // the initial values count as writes as well
+    poll();
+
+    wait(25, sc_core::SC_NS);
+    poll();
+    XREPORT("run: Setting the period to 20 ns");
+    m_broker.get_param_handle("timer.period").set_cci_value(
+        cci::cci_value(20));
+
+    wait(20, sc_core::SC_NS);
+    poll();
+    // the rejected batch leaves the period unmodified and unreported
+    XREPORT("run: Setting period 5 ns and limit 0 with a write batch");
+    cci::cci_param_write_batch batch = m_broker.create_write_batch();
+    batch.set_cci_value("timer.period", cci::cci_value(5));
+    batch.set_cci_value("timer.limit", cci::cci_value(0));
+    try {
+      batch.commit();
+    } catch (sc_core::sc_report const &) {
+      cci::cci_handle_exception(cci::CCI_SET_PARAM_FAILURE);
+    }
+
+    for (int i = 0; i < 4; ++i) {
+      wait(20, sc_core::SC_NS);
+      poll();
+    }
+  }
+
+ private:
+  cci::cci_broker_handle m_broker; ///< Broker handle
+  cci::uint64 m_seen;              ///< Generation sampled by the last poll
+};
+// ex28_monitor
+
+#endif  // EXAMPLES_EX28_WRITE_GENERATIONS_EX28_MONITOR_H_
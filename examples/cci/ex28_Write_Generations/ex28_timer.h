@@ -0,0 +1,85 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex28_timer.h
+ * @brief  A timer counting its ticks in a parameter
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX28_WRITE_GENERATIONS_EX28_TIMER_H_
+#define EXAMPLES_EX28_WRITE_GENERATIONS_EX28_TIMER_H_
+
+#include <cci_configuration>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex28_timer
+ *  @brief  The timer counts up to a limit, the limit must be positive
+ */
+SC_MODULE(ex28_timer) {
+ public:
+  /**
+   *  @fn     ex28_timer
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex28_timer)
+      : period("period", 10),
+        limit("limit", 6),
+        ticks("ticks", 0)
+  {
+    limit.register_pre_write_callback(&ex28_timer::check_limit, this);
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     bool check_limit(const cci::cci_param_write_event<int>& ev)
+   *  @brief  Pre write callback, rejecting a limit less than one
+   *  @param  ev  The write event
+   *  @return false, to reject the write
+   */
+  bool check_limit(const cci::cci_param_write_event<int>& ev) {
+    if (ev.new_value < 1) {
+      XREPORT("[TIMER check] : rejecting limit " << ev.new_value);
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Counts the ticks
+   *  @return void
+   */
+  void run() {
+    while (ticks < limit) {
+      wait(period, sc_core::SC_NS);
+      ticks = ticks + 1;
+    }
+  }
+
+ private:
+  cci::cci_param<int> period; ///< Tick period in ns
+  cci::cci_param<int> limit;  ///< Number of ticks
+  cci::cci_param<int> ticks;  ///< Ticks counted so far
+};
+// ex28_timer
+
+#endif  // EXAMPLES_EX28_WRITE_GENERATIONS_EX28_TIMER_H_
@@ -0,0 +1,99 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex29_cluster.h
+ * @brief  A processor cluster with a parameter hierarchy
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX29_PARAM_QUERIES_EX29_CLUSTER_H_
+#define EXAMPLES_EX29_PARAM_QUERIES_EX29_CLUSTER_H_
+
+#include <cci_configuration>
+
+/**
+ *  @class  ex29_cache
+ *  @brief  A cache with a size and an associativity
+ */
+SC_MODULE(ex29_cache) {
+ public:
+  /**
+   *  @fn     ex29_cache
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex29_cache)
+      : size("size", 256),
+        ways("ways", 8)
+  {}
+
+ private:
+  cci::cci_param<int> size; ///< Size in KiB
+  cci::cci_param<int> ways; ///< Associativity
+};
+// ex29_cache
+
+/**
+ *  @class  ex29_core
+ *  @brief  A processor core with a private l2 cache
+ */
+SC_MODULE(ex29_core) {
+ public:
+  /**
+   *  @fn     ex29_core
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex29_core)
+      : freq_mhz("freq_mhz", 1000),
+        l2("l2")
+  {}
+
+ private:
+  cci::cci_param<int> freq_mhz; ///< Clock frequency
+  ex29_cache l2;                ///< Level 2 cache
+};
+// ex29_core
+
+/**
+ *  @class  ex29_cluster
+ *  @brief  Two cpu cores and a dsp core
+ */
+SC_MODULE(ex29_cluster) {
+ public:
+  /**
+   *  @fn     ex29_cluster
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex29_cluster)
+      : cpu0("cpu0"),
+        cpu1("cpu1"),
+        dsp("dsp")
+  {}
+
+ private:
+  ex29_core cpu0; ///< First cpu core
+  ex29_core cpu1; ///< Second cpu core
+  ex29_core dsp;  ///< Dsp core
+};
+// ex29_cluster
+
+#endif  // EXAMPLES_EX29_PARAM_QUERIES_EX29_CLUSTER_H_
@@ -0,0 +1,106 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex29_inspector.h
+ * @brief  A tool querying the parameters by name patterns
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX29_PARAM_QUERIES_EX29_INSPECTOR_H_
+#define EXAMPLES_EX29_PARAM_QUERIES_EX29_INSPECTOR_H_
+
+#include <cci_configuration>
+#include <string>
+#include <vector>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex29_inspector
+ *  @brief  The inspector lists and updates the parameters matching
+ *          hierarchical name patterns
+ */
+SC_MODULE(ex29_inspector) {
+ public:
+  SC_HAS_PROCESS(ex29_inspector);
+
+  /**
+   *  @fn     ex29_inspector
+   *  @brief  The class constructor
+   *  @param  name   The module name
+   *  @param  broker The broker to query
+   *  @return void
+   */
+  ex29_inspector(sc_core::sc_module_name name, cci_utils::broker& broker)
+      : sc_core::sc_module(name),
+        m_broker(broker),
+        m_originator()
+  {
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     std::vector<cci::cci_param_untyped_handle> list(const std::string& pattern)
+   *  @brief  Reports the parameters matching a pattern
+   *  @param  pattern The name pattern
+   *  @return The handles of the matching parameters
+   */
+  std::vector<cci::cci_param_untyped_handle> list(const std::string& pattern) {
+    // only the matching sub-hierarchies are visited
+    std::vector<cci::cci_param_untyped_handle> handles =
+        m_broker.find_param_handles(pattern, m_originator);
+    XREPORT("list: " << pattern << " (" << handles.size() << " matches)");
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+      XREPORT("list:   " << handles[i].name() << " = "
+              << handles[i].get_cci_value().to_json());
+    }
+    return handles;
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Queries and updates the parameters
+   *  @return void
+   */
+  void run() {
+    // "**" matches any number of levels, including none
+    list("top.cpu0.**");
+    list("top.cpu0.l2.size.**");
+    list("top.**.ways");
+    list("top.cpu?.freq_mhz");
+
+    // "*" matches a single level
+    std::vector<cci::cci_param_untyped_handle> sizes = list("top.*.l2.size");
+    XREPORT("run: Doubling all l2 sizes");
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+      sizes[i].set_cci_value(
+          cci::cci_value(sizes[i].get_cci_value().get_int() * 2));
+    }
+    list("top.*.l2.size");
+
+    list("top.gpu.**");
+  }
+
+ private:
+  cci_utils::broker& m_broker;      ///< The queried broker
+  cci::cci_originator m_originator; ///< Originator of the queries
+};
+// ex29_inspector
+
+#endif  // EXAMPLES_EX29_PARAM_QUERIES_EX29_INSPECTOR_H_
@@ -0,0 +1,74 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex30_platform.h
+ * @brief  A platform whose parameter set is static after elaboration
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX30_FROZEN_BROKER_EX30_PLATFORM_H_
+#define EXAMPLES_EX30_FROZEN_BROKER_EX30_PLATFORM_H_
+
+#include <cci_configuration>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex30_platform
+ *  @brief  The platform freezes the broker at the end of the elaboration
+ */
+SC_MODULE(ex30_platform) {
+ public:
+  SC_HAS_PROCESS(ex30_platform);
+
+  /**
+   *  @fn     ex30_platform
+   *  @brief  The class constructor
+   *  @param  name   The module name
+   *  @param  broker The broker to freeze
+   *  @return void
+   */
+  ex30_platform(sc_core::sc_module_name name, cci_utils::broker& broker)
+      : sc_core::sc_module(name),
+        m_broker(broker),
+        cpu_mhz("cpu_mhz", 1000),
+        bus_mhz("bus_mhz", 250),
+        mem_kib("mem_kib", 4096)
+  {}
+
+  /**
+   *  @fn     void end_of_elaboration()
+   *  @brief  Freezes the broker, the parameter set is complete now
+   *  @return void
+   */
+  void end_of_elaboration() {
+    m_broker.freeze();
+    XREPORT("end_of_elaboration: Broker frozen: "
+            << std::boolalpha << m_broker.is_frozen());
+  }
+
+ private:
+  cci_utils::broker& m_broker;  ///< The broker of the platform
+  cci::cci_param<int> cpu_mhz;  ///< Cpu clock frequency
+  cci::cci_param<int> bus_mhz;  ///< Bus clock frequency
+  cci::cci_param<int> mem_kib;  ///< Memory size
+};
+// ex30_platform
+
+#endif  // EXAMPLES_EX30_FROZEN_BROKER_EX30_PLATFORM_H_
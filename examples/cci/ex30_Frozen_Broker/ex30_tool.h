@@ -0,0 +1,104 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex30_tool.h
+ * @brief  A tool inspecting and modifying the parameters during the simulation
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX30_FROZEN_BROKER_EX30_TOOL_H_
+#define EXAMPLES_EX30_FROZEN_BROKER_EX30_TOOL_H_
+
+#include <cci_configuration>
+#include <vector>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex30_tool
+ *  @brief  The tool uses the frozen broker, adds and removes a parameter
+ *          late and freezes the broker again
+ */
+SC_MODULE(ex30_tool) {
+ public:
+  SC_HAS_PROCESS(ex30_tool);
+
+  /**
+   *  @fn     ex30_tool
+   *  @brief  The class constructor
+   *  @param  name   The module name
+   *  @param  broker The inspected broker
+   *  @return void
+   */
+  ex30_tool(sc_core::sc_module_name name, cci_utils::broker& broker)
+      : sc_core::sc_module(name),
+        m_broker(broker)
+  {
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     void list()
+   *  @brief  Reports all parameters and the state of the broker
+   *  @return void
+   */
+  void list() {
+    XREPORT("list: Broker frozen: " << std::boolalpha << m_broker.is_frozen());
+    std::vector<cci::cci_param_untyped_handle> handles =
+        m_broker.get_param_handles(cci::cci_originator());
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+      XREPORT("list:   " << handles[i].name() << " = "
+              << handles[i].get_cci_value().to_json());
+    }
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Inspects and modifies the parameters
+   *  @return void
+   */
+  void run() {
+    list();
+
+    // writes do not modify the parameter set, the broker stays frozen
+    wait(10, sc_core::SC_NS);
+    XREPORT("run: Setting the bus to 500 MHz");
+    m_broker.get_param_handle("platform.bus_mhz", cci::cci_originator())
+        .set_cci_value(cci::cci_value(500));
+    list();
+
+    // late parameters are still supported, but end the frozen state
+    wait(10, sc_core::SC_NS);
+    XREPORT("run: Adding a late parameter");
+    cci::cci_param<bool>* trace = new cci::cci_param<bool>("trace", true);
+    list();
+
+    wait(10, sc_core::SC_NS);
+    XREPORT("run: Removing the late parameter and freezing again");
+    delete trace;
+    m_broker.freeze();
+    list();
+  }
+
+ private:
+  cci_utils::broker& m_broker; ///< The inspected broker
+};
+// ex30_tool
+
+#endif  // EXAMPLES_EX30_FROZEN_BROKER_EX30_TOOL_H_
@@ -0,0 +1,74 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex31_cpu.h
+ * @brief  A cpu whose parameters are preset from files
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX31_PRESET_LOADER_EX31_CPU_H_
+#define EXAMPLES_EX31_PRESET_LOADER_EX31_CPU_H_
+
+#include <cci_configuration>
+#include <string>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex31_cpu
+ *  @brief  The cpu reports the values its parameters were preset to
+ */
+SC_MODULE(ex31_cpu) {
+ public:
+  /**
+   *  @fn     ex31_cpu
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex31_cpu)
+      : core_name("name", "cpu"),
+        mhz("mhz", 100),
+        cores("cores", 1),
+        cache_kib("cache_kib", 16),
+        trace("trace", false)
+  {}
+
+  /**
+   *  @fn     void end_of_elaboration()
+   *  @brief  Reports the parameter values
+   *  @return void
+   */
+  void end_of_elaboration() {
+    XREPORT("name      = " << core_name.get_value());
+    XREPORT("mhz       = " << mhz.get_value());
+    XREPORT("cores     = " << cores.get_value());
+    XREPORT("cache_kib = " << cache_kib.get_value());
+    XREPORT("trace     = " << std::boolalpha << trace.get_value());
+  }
+
+ private:
+  cci::cci_param<std::string> core_name;  ///< Name of the core
+  cci::cci_param<int> mhz;                ///< Clock frequency
+  cci::cci_param<int> cores;              ///< Number of cores
+  cci::cci_param<int> cache_kib;          ///< Cache size
+  cci::cci_param<bool> trace;             ///< Enable tracing
+};
+// ex31_cpu
+
+#endif  // EXAMPLES_EX31_PRESET_LOADER_EX31_CPU_H_
@@ -0,0 +1,78 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex31_loader.h
+ * @brief  Loads the preset values of the platform
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX31_PRESET_LOADER_EX31_LOADER_H_
+#define EXAMPLES_EX31_PRESET_LOADER_EX31_LOADER_H_
+
+#include <cci_configuration>
+#include <cstring>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex31_loader
+ *  @brief  Passes the presets of a JSON and a line-oriented file to the
+ *          broker, and shows how a malformed input is reported
+ */
+SC_MODULE(ex31_loader) {
+ public:
+  /**
+   *  @fn     ex31_loader
+   *  @brief  The class constructor, loads the presets
+   *  @return void
+   */
+  SC_CTOR(ex31_loader)
+      : m_loader(cci::cci_get_broker()) {
+    load_file("presets.json");
+    load_file("presets.cfg");
+
+    // the second line has trailing characters after its value
+    const char* overrides = "cpu.mhz 1200\n"
+                            "cpu.cores 8 cores\n";
+    XREPORT("Loading overrides");
+    try {
+      m_loader.load(overrides, std::strlen(overrides));
+    } catch (sc_core::sc_report const & e) {
+      XREPORT("Rejected: " << e.get_msg());
+    }
+    XREPORT("Presets applied from overrides: " << m_loader.loaded_count());
+  }
+
+ private:
+  /**
+   *  @fn     void load_file(const char* filename)
+   *  @brief  Loads the presets of a file
+   *  @param  filename The name of the file, its format is detected
+   *  @return void
+   */
+  void load_file(const char* filename) {
+    const std::size_t count = m_loader.load_file(filename);
+    XREPORT("Presets applied from " << filename << ": " << count);
+  }
+
+  cci_utils::preset_loader m_loader;  ///< The loader
+};
+// ex31_loader
+
+#endif  // EXAMPLES_EX31_PRESET_LOADER_EX31_LOADER_H_
@@ -0,0 +1,65 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex32_clock.h
+ * @brief  A clock whose period is changed during the simulation
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX32_PINNED_HANDLES_EX32_CLOCK_H_
+#define EXAMPLES_EX32_PINNED_HANDLES_EX32_CLOCK_H_
+
+#include <cci_configuration>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex32_clock
+ *  @brief  The clock owns the period parameter and doubles it once
+ */
+SC_MODULE(ex32_clock) {
+ public:
+  /**
+   *  @fn     ex32_clock
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex32_clock)
+      : period_ns("period_ns", 10, "Clock period in ns")
+  {
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Changes the clock period
+   *  @return void
+   */
+  void run() {
+    wait(25, sc_core::SC_NS);
+    XREPORT("run: Setting the period to 20 ns");
+    period_ns = 20;
+  }
+
+ private:
+  cci::cci_param<int> period_ns;  ///< Clock period
+};
+// ex32_clock
+
+#endif  // EXAMPLES_EX32_PINNED_HANDLES_EX32_CLOCK_H_
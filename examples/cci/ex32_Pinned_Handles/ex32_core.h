@@ -0,0 +1,92 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex32_core.h
+ * @brief  A core reading the clock period through a pinned handle
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX32_PINNED_HANDLES_EX32_CORE_H_
+#define EXAMPLES_EX32_PINNED_HANDLES_EX32_CORE_H_
+
+#include <cci_configuration>
+#include "xreport.hpp"
+
+/**
+ *  @class  ex32_core
+ *  @brief  The core reads the clock period every cycle.  The pinned handle
+ *          reads the value directly, unless a read callback is registered.
+ */
+SC_MODULE(ex32_core) {
+ public:
+  /**
+   *  @fn     ex32_core
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex32_core)
+      : m_broker(cci::cci_get_broker()),
+        m_period(m_broker.get_param_handle("clock.period_ns"))
+  {
+    sc_assert(m_period.is_valid());
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     void on_read(const cci::cci_param_read_event<int>& ev)
+   *  @brief  Pre read callback, reports the regular reads
+   *  @param  ev  The read event
+   *  @return void
+   */
+  void on_read(const cci::cci_param_read_event<int>& ev) {
+    XREPORT("on_read: " << ev.param_handle.name() << " = " << ev.value);
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Runs a few cycles, reading the period in each of them
+   *  @return void
+   */
+  void run() {
+    cci::cci_callback_untyped_handle cb;
+    for (int cycle = 0; cycle < 6; ++cycle) {
+      if (cycle == 2) {
+        // reads take the regular path while a read callback is registered
+        XREPORT("run: Registering a read callback");
+        cb = m_period.register_pre_read_callback(&ex32_core::on_read, this);
+      } else if (cycle == 4) {
+        // the next read pins the value again
+        XREPORT("run: Unregistering the read callback");
+        m_period.unregister_pre_read_callback(cb);
+      }
+      // a direct read of the pinned value, as long as nothing changed
+      const int period = *m_period;
+      XREPORT("run: Cycle " << cycle << ", period " << period << " ns");
+      wait(period, sc_core::SC_NS);
+    }
+  }
+
+ private:
+  cci::cci_broker_handle m_broker;              ///< The broker handle
+  cci::cci_param_pinned_handle<int> m_period;  ///< The clock period
+};
+// ex32_core
+
+#endif  // EXAMPLES_EX32_PINNED_HANDLES_EX32_CORE_H_
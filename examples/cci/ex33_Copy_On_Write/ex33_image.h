@@ -0,0 +1,40 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex33_image.h
+ * @brief  The memory image type, stored in shared buffers
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX33_COPY_ON_WRITE_EX33_IMAGE_H_
+#define EXAMPLES_EX33_COPY_ON_WRITE_EX33_IMAGE_H_
+
+#include <cci_configuration>
+#include <vector>
+
+/// Memory image, the words of a memory
+typedef std::vector<int> ex33_image;
+
+namespace cci {
+/// Parameters of the memory image type share their value buffers
+template<> struct cci_param_shared_storage<ex33_image> : std::true_type {};
+}  // namespace cci
+
+#endif  // EXAMPLES_EX33_COPY_ON_WRITE_EX33_IMAGE_H_
@@ -0,0 +1,90 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex33_memory.h
+ * @brief  A memory holding its initial image in a parameter
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX33_COPY_ON_WRITE_EX33_MEMORY_H_
+#define EXAMPLES_EX33_COPY_ON_WRITE_EX33_MEMORY_H_
+
+#include <cci_configuration>
+#include "ex33_image.h"
+#include "xreport.hpp"
+
+/**
+ *  @class  ex33_memory
+ *  @brief  The memory patches its image and resets it again
+ */
+SC_MODULE(ex33_memory) {
+ public:
+  /**
+   *  @fn     ex33_memory
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex33_memory)
+      : image("image", ex33_image(64 * 1024, 0x13), "Initial memory image")
+  {
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     void report()
+   *  @brief  Reports, whether the current and the default value are shared
+   *  @return void
+   */
+  void report() {
+    XREPORT("report: Default value: " << std::boolalpha
+            << image.is_default_value() << ", shared with the default: "
+            << (&image.get_value() == &image.get_default_value()));
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Patches the image and resets it
+   *  @return void
+   */
+  void run() {
+    // the default and the current value share a single buffer
+    report();
+
+    // a write replaces the buffer, the default is kept unchanged
+    wait(10, sc_core::SC_NS);
+    XREPORT("run: Patching word 0");
+    ex33_image patched = image.get_value();
+    patched[0] = 0x42;
+    image = patched;
+    report();
+
+    // the reset shares the default buffer again
+    wait(10, sc_core::SC_NS);
+    XREPORT("run: Resetting the image");
+    image.reset();
+    report();
+  }
+
+ private:
+  cci::cci_param<ex33_image> image;  ///< Memory image
+};
+// ex33_memory
+
+#endif  // EXAMPLES_EX33_COPY_ON_WRITE_EX33_MEMORY_H_
@@ -0,0 +1,75 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+/**
+ * @file   ex33_viewer.h
+ * @brief  A viewer reading the memory image through a handle
+ * @author Accellera CCI Working Group
+ */
+
+#ifndef EXAMPLES_EX33_COPY_ON_WRITE_EX33_VIEWER_H_
+#define EXAMPLES_EX33_COPY_ON_WRITE_EX33_VIEWER_H_
+
+#include <cci_configuration>
+#include "ex33_image.h"
+#include "xreport.hpp"
+
+/**
+ *  @class  ex33_viewer
+ *  @brief  The viewer reads the image by reference, without copying it
+ */
+SC_MODULE(ex33_viewer) {
+ public:
+  /**
+   *  @fn     ex33_viewer
+   *  @brief  The class constructor
+   *  @return void
+   */
+  SC_CTOR(ex33_viewer)
+      : m_broker(cci::cci_get_broker()),
+        m_image(m_broker.get_param_handle("memory.image"))
+  {
+    sc_assert(m_image.is_valid());
+    SC_THREAD(run);
+  }
+
+  /**
+   *  @fn     void run()
+   *  @brief  Reads the image after each change of the memory
+   *  @return void
+   */
+  void run() {
+    for (int i = 0; i < 3; ++i) {
+      wait(5, sc_core::SC_NS);
+      // a reference to the stored buffer, not a copy
+      const ex33_image& image = m_image.get_value();
+      XREPORT("run: " << image.size() << " words, word 0 = 0x"
+              << std::hex << image[0] << std::dec << ", shared with the default: "
+              << std::boolalpha << (&image == &m_image.get_default_value()));
+      wait(5, sc_core::SC_NS);
+    }
+  }
+
+ private:
+  cci::cci_broker_handle m_broker;                    ///< The broker handle
+  cci::cci_param_typed_handle<ex33_image> m_image;  ///< The memory image
+};
+// ex33_viewer
+
+#endif  // EXAMPLES_EX33_COPY_ON_WRITE_EX33_VIEWER_H_
@@ -22,10 +22,12 @@
 
 #include "cci/core/cci_callback.h"
 #include "cci/core/cci_value.h"
+#include "cci/cfg/cci_param_callbacks.h"
 
 CCI_OPEN_NAMESPACE_
 
 class cci_param_untyped_handle;
+class cci_param_view;
 class cci_originator;
 
 /// Parameter creation callback
@@ -52,6 +54,10 @@ typedef cci_callback<const cci_param_untyped_handle&, bool >
 typedef cci_callback_typed_handle<const cci_param_untyped_handle&, bool >
         cci_param_predicate_handle;
 
+/// Parameter visitor (returns false to stop the iteration)
+typedef cci_callback<const cci_param_view&, bool >
+        cci_param_visitor;
+
 /// Preset value predicate
 typedef cci_callback<const std::pair<std::string, cci_value>&, bool >
         cci_preset_value_predicate;
@@ -79,6 +85,47 @@ struct cci_broker_callback_if
   unregister_destroy_callback( const cci_param_destroy_callback_handle& cb
                              , const cci_originator& orig ) = 0;
 
+  /** @name Parameter access subscriptions
+   *
+   * A subscription registers a single (untyped) callback for the accesses
+   * of all parameters with a name matching the given pattern, including
+   * parameters created after the subscription.  See the broker
+   * implementation for the supported pattern syntax.
+   *
+   * Brokers without support for subscriptions return an invalid handle
+   * (and false from unregister_subscription()).
+   */
+  //@{
+  virtual cci_callback_untyped_handle
+  register_pre_write_subscription( const std::string& pattern
+                                 , const cci_param_pre_write_callback_untyped& cb
+                                 , const cci_originator& orig )
+    { return cci_callback_untyped_handle(); }
+
+  virtual cci_callback_untyped_handle
+  register_post_write_subscription( const std::string& pattern
+                                  , const cci_param_post_write_callback_untyped& cb
+                                  , const cci_originator& orig )
+    { return cci_callback_untyped_handle(); }
+
+  virtual cci_callback_untyped_handle
+  register_pre_read_subscription( const std::string& pattern
+                                , const cci_param_pre_read_callback_untyped& cb
+                                , const cci_originator& orig )
+    { return cci_callback_untyped_handle(); }
+
+  virtual cci_callback_untyped_handle
+  register_post_read_subscription( const std::string& pattern
+                                 , const cci_param_post_read_callback_untyped& cb
+                                 , const cci_originator& orig )
+    { return cci_callback_untyped_handle(); }
+
+  virtual bool
+  unregister_subscription( const cci_callback_untyped_handle& cb
+                         , const cci_originator& orig )
+    { return false; }
+  //@}
+
   virtual bool unregister_all_callbacks(const cci_originator& orig) = 0;
 
   virtual bool has_callbacks() const = 0;
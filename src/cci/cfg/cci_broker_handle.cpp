@@ -25,6 +25,7 @@
 
 #include "cci/cfg/cci_broker_if.h"
 #include "cci/cfg/cci_broker_manager.h"
+#include "cci/cfg/cci_param_write_batch.h"
 #include "cci/cfg/cci_report_handler.h"
 
 CCI_OPEN_NAMESPACE_
@@ -59,6 +60,18 @@ void cci_broker_handle::set_preset_cci_value(
     m_broker->set_preset_cci_value(parname, cci_value, m_originator);
 }
 
+std::vector<std::string> cci_broker_handle::set_preset_cci_values(
+  const std::vector<cci_name_value_pair>& presets)
+{
+    return m_broker->set_preset_cci_values(presets, m_originator);
+}
+
+std::vector<std::string> cci_broker_handle::set_preset_cci_values(
+  std::vector<cci_name_value_pair>&& presets)
+{
+    return m_broker->set_preset_cci_values(CCI_MOVE_(presets), m_originator);
+}
+
 cci::cci_value cci_broker_handle::get_preset_cci_value(
   const std::string &parname) const
 {
@@ -142,6 +155,22 @@ bool cci_broker_handle::is_global_broker() const
     return m_broker->is_global_broker();
 }
 
+std::vector<cci_param_untyped_handle>
+cci_broker_handle::get_changed_param_handles(uint64 generation) const
+{
+    return m_broker->get_changed_param_handles(generation, m_originator);
+}
+
+cci_param_write_batch cci_broker_handle::create_write_batch() const
+{
+    return cci_param_write_batch(*this);
+}
+
+bool cci_broker_handle::for_each_param(const cci_param_visitor& visitor) const
+{
+    return m_broker->for_each_param(visitor, m_originator);
+}
+
 cci_param_create_callback_handle cci_broker_handle::register_create_callback(
   const cci_param_create_callback& cb)
 {
@@ -166,6 +195,46 @@ bool cci_broker_handle::unregister_destroy_callback(
     return m_broker->unregister_destroy_callback(cb, m_originator);
 }
 
+cci_callback_untyped_handle
+cci_broker_handle::register_pre_write_subscription(
+  const std::string& pattern,
+  const cci_param_pre_write_callback_untyped& cb)
+{
+    return m_broker->register_pre_write_subscription(pattern, cb, m_originator);
+}
+
+cci_callback_untyped_handle
+cci_broker_handle::register_post_write_subscription(
+  const std::string& pattern,
+  const cci_param_post_write_callback_untyped& cb)
+{
+    return m_broker->register_post_write_subscription(pattern, cb,
+                                                      m_originator);
+}
+
+cci_callback_untyped_handle
+cci_broker_handle::register_pre_read_subscription(
+  const std::string& pattern,
+  const cci_param_pre_read_callback_untyped& cb)
+{
+    return m_broker->register_pre_read_subscription(pattern, cb, m_originator);
+}
+
+cci_callback_untyped_handle
+cci_broker_handle::register_post_read_subscription(
+  const std::string& pattern,
+  const cci_param_post_read_callback_untyped& cb)
+{
+    return m_broker->register_post_read_subscription(pattern, cb,
+                                                     m_originator);
+}
+
+bool cci_broker_handle::unregister_subscription(
+  const cci_callback_untyped_handle& cb)
+{
+    return m_broker->unregister_subscription(cb, m_originator);
+}
+
 bool cci_broker_handle::unregister_all_callbacks()
 {
     return m_broker->unregister_all_callbacks(m_originator);
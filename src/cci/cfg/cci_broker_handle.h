@@ -35,6 +35,7 @@ CCI_OPEN_NAMESPACE_
 // Forward declarations
 class cci_param_if;
 class cci_broker_if;
+class cci_param_write_batch;
 template<typename T> class cci_param_typed_handle;
 
 // CCI Broker handle class
@@ -91,6 +92,14 @@ public:
     void set_preset_cci_value(const std::string &parname,
                                const cci_value &cci_value);
 
+    /// @copydoc cci_broker_if::set_preset_cci_values(const std::vector<cci_name_value_pair>&, const cci_originator&)
+    std::vector<std::string>
+    set_preset_cci_values(const std::vector<cci_name_value_pair>& presets);
+
+    /// @copydoc cci_broker_if::set_preset_cci_values(std::vector<cci_name_value_pair>&&, const cci_originator&)
+    std::vector<std::string>
+    set_preset_cci_values(std::vector<cci_name_value_pair>&& presets);
+
     /// @copydoc cci_broker_if::get_preset_cci_value
     cci_value get_preset_cci_value(const std::string &parname) const;
 
@@ -148,6 +157,35 @@ public:
         return cci_param_typed_handle<T>(get_param_handle(parname));
     }
 
+    /// @copydoc cci_broker_if::get_changed_param_handles
+    std::vector<cci_param_untyped_handle>
+    get_changed_param_handles(uint64 generation) const;
+
+    /// Create a batch of parameter writes, committed as a whole
+    /**
+     * The writes of the batch are performed on behalf of the originator
+     * of this handle.
+     *
+     * @return empty write batch
+     * @see cci_param_write_batch
+     */
+    cci_param_write_batch create_write_batch() const;
+
+    /// Visit all parameters
+    /**
+     * Calls the visitor with a cci_param_view of each parameter, accessing
+     * the parameters on behalf of the originator of this handle.  The
+     * visitor may return false to stop the iteration.
+     *
+     * @note The visitor must not create or destroy parameters, nor add
+     *       preset values for names unknown to the broker (see
+     *       cci_broker_if::for_each_param).
+     *
+     * @param visitor Callback called for each parameter
+     * @return false, if the iteration has been stopped by the visitor
+     */
+    bool for_each_param(const cci_param_visitor& visitor) const;
+
     /** @name Parameter creation/destruction callbacks */
     //@{
     /// @copydoc cci_broker_callback_if::register_create_callback
@@ -189,6 +227,36 @@ public:
     bool
     unregister_destroy_callback(const cci_param_destroy_callback_handle& cb);
 
+    /** @name Parameter access subscriptions */
+    //@{
+    /// @copydoc cci_broker_callback_if::register_pre_write_subscription
+    cci_callback_untyped_handle
+    register_pre_write_subscription(
+        const std::string& pattern,
+        const cci_param_pre_write_callback_untyped& cb);
+
+    /// @copydoc cci_broker_callback_if::register_post_write_subscription
+    cci_callback_untyped_handle
+    register_post_write_subscription(
+        const std::string& pattern,
+        const cci_param_post_write_callback_untyped& cb);
+
+    /// @copydoc cci_broker_callback_if::register_pre_read_subscription
+    cci_callback_untyped_handle
+    register_pre_read_subscription(
+        const std::string& pattern,
+        const cci_param_pre_read_callback_untyped& cb);
+
+    /// @copydoc cci_broker_callback_if::register_post_read_subscription
+    cci_callback_untyped_handle
+    register_post_read_subscription(
+        const std::string& pattern,
+        const cci_param_post_read_callback_untyped& cb);
+
+    /// @copydoc cci_broker_callback_if::unregister_subscription
+    bool unregister_subscription(const cci_callback_untyped_handle& cb);
+    //@}
+
     /// @copydoc cci_broker_callback_if::unregister_all_callbacks
     bool unregister_all_callbacks();
 
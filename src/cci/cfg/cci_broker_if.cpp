@@ -0,0 +1,80 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+/**
+ * @file   cci_broker_if.cpp
+ * @brief  Default implementations of the broker interface
+ */
+
+#include "cci/cfg/cci_broker_if.h"
+
+CCI_OPEN_NAMESPACE_
+
+std::vector<std::string>
+cci_broker_if::set_preset_cci_values(
+  const std::vector<cci_name_value_pair>& presets,
+  const cci_originator& originator)
+{
+  // forwards to the single preset updates by default, failures are
+  // reported by each of them
+  std::vector<cci_name_value_pair>::const_iterator it;
+  for (it = presets.begin(); it != presets.end(); ++it)
+    set_preset_cci_value(it->first, it->second, originator);
+  return std::vector<std::string>();
+}
+
+std::vector<std::string>
+cci_broker_if::set_preset_cci_values(
+  std::vector<cci_name_value_pair>&& presets,
+  const cci_originator& originator)
+{
+  // copies the values by default
+  const std::vector<cci_name_value_pair>& batch = presets;
+  return set_preset_cci_values(batch, originator);
+}
+
+std::vector<cci_param_untyped_handle>
+cci_broker_if::get_changed_param_handles(uint64 generation,
+                                         const cci_originator& originator) const
+{
+  // filters all parameters by default
+  std::vector<cci_param_untyped_handle> handles =
+    get_param_handles(originator);
+  std::vector<cci_param_untyped_handle> changed;
+  std::vector<cci_param_untyped_handle>::const_iterator it;
+  for (it = handles.begin(); it != handles.end(); ++it)
+    if (it->get_write_generation() > generation)
+      changed.push_back(*it);
+  return changed;
+}
+
+bool cci_broker_if::for_each_param(const cci_param_visitor& visitor,
+                                   const cci_originator& originator) const
+{
+  // visits the parameter handles by default, which allows the visitor to
+  // modify the broker
+  std::vector<cci_param_untyped_handle> handles =
+    get_param_handles(originator);
+  std::vector<cci_param_untyped_handle>::const_iterator it;
+  for (it = handles.begin(); it != handles.end(); ++it)
+    if (it->is_valid() && !visitor(cci_param_view(*it)))
+      return false;
+  return true;
+}
+
+CCI_CLOSE_NAMESPACE_
@@ -22,6 +22,7 @@
 
 #include "cci/cfg/cci_broker_types.h"
 #include "cci/cfg/cci_param_untyped_handle.h"
+#include "cci/cfg/cci_param_view.h"
 #include "cci/cfg/cci_broker_handle.h"
 
 CCI_OPEN_NAMESPACE_
@@ -102,6 +103,44 @@ public:
                                        const cci::cci_value &cci_value,
                                        const cci_originator& originator) = 0;
 
+    /// Set the preset values of several parameters.
+    /**
+     * Equivalent to calling set_preset_cci_value for each element, but
+     * merges the whole batch at once.  Locked preset values are skipped
+     * and reported once, after all other preset values of the batch have
+     * been set.  The returned names are only available, if the reported
+     * error does not throw (see sc_core::sc_report_handler::set_actions).
+     *
+     * @exception        cci::cci_report::set_param_failed Setting at least
+     *                   one preset value failed
+     * @param presets    Pairs of full hierarchical parameter names and
+     *                   preset values (later entries take precedence)
+     * @param originator originator reference to the originator
+     *                   (not applicable in case of broker handle)
+     * @return           Names of the parameters whose preset value could
+     *                   not be set
+     *
+     * The default implementation calls set_preset_cci_value for each
+     * element, i.e. each failure is reported immediately, and returns an
+     * empty list.
+     */
+    virtual std::vector<std::string>
+    set_preset_cci_values(const std::vector<cci_name_value_pair>& presets,
+                          const cci_originator& originator);
+
+    /// Set the preset values of several parameters, taking over the values
+    /**
+     * Like set_preset_cci_values(const std::vector<cci_name_value_pair>&,
+     * const cci_originator&), but allows the broker to take over the
+     * preset values instead of copying them.  The contents of the batch
+     * are unspecified afterwards.
+     *
+     * The default implementation forwards to the copying variant.
+     */
+    virtual std::vector<std::string>
+    set_preset_cci_values(std::vector<cci_name_value_pair>&& presets,
+                          const cci_originator& originator);
+
     /// Get a parameter's preset value.
     /**
      *
@@ -258,6 +297,50 @@ public:
     get_param_handles(cci_param_predicate& pred,
                       const cci_originator& originator) const = 0;
 
+    /// Return handles of all parameters written since a given generation
+    /**
+     * Allows to poll for parameter changes without registering callbacks.
+     * Sample cci_param_untyped::current_write_generation() before the
+     * query and pass it to the next one.
+     *
+     * Brokers tracking the writes of their parameters (see
+     * cci_param_if::set_write_list) only visit the written parameters,
+     * i.e. the cost of a poll depends on the number of changes.
+     *
+     * @param generation Write generation sampled before the previous query
+     * @param originator Originator of the returned handles
+     * @return Handles of the parameters whose write generation is greater
+     *         than @a generation
+     * @see cci_param_untyped::get_write_generation
+     *
+     * The default implementation filters the result of get_param_handles.
+     */
+    virtual std::vector<cci_param_untyped_handle>
+    get_changed_param_handles(uint64 generation,
+                              const cci_originator& originator) const;
+
+    /// Visit all parameters
+    /**
+     * Calls the visitor with a cci_param_view of each parameter, without
+     * creating parameter handles.  The visitor may return false to stop
+     * the iteration.
+     *
+     * The parameters are visited in place.  The visitor may read and write
+     * parameter values, but must not create or destroy parameters, nor add
+     * preset values for names unknown to the broker.  To change the set of
+     * parameters based on a walk, collect the names (or use
+     * get_param_handles) first.  Brokers may detect such modifications and
+     * abort (cci_utils::consuming_broker asserts).
+     *
+     * @param visitor    Callback called for each parameter
+     * @param originator Originator of the accesses through the views
+     * @return false, if the iteration has been stopped by the visitor
+     *
+     * The default implementation visits the result of get_param_handles.
+     */
+    virtual bool for_each_param(const cci_param_visitor& visitor,
+                                const cci_originator& originator) const;
+
     ///If this broker is a private broker (or handle)
     /**
      * @return If this broker is the global broker
@@ -26,17 +26,34 @@ CCI_OPEN_NAMESPACE_
 
 std::map<const sc_core::sc_object*, cci_broker_if*> cci_broker_manager::m_brokers;
 
+std::unordered_map<const sc_core::sc_object*, cci_broker_manager::resolution>
+  cci_broker_manager::m_resolved;
+
 cci_broker_handle
 cci_broker_manager::get_broker(const cci_originator &originator)
 {
-  const sc_core::sc_object *org=originator.get_object();
+  return find_broker(originator.get_object()).create_broker_handle(originator);
+}
+
+cci_broker_if&
+cci_broker_manager::find_broker(const sc_core::sc_object* obj)
+{
+  // The cached resolution is only used, if the object still has the same
+  // parent, i.e. the address has not been reused for a different object.
+  if (obj) {
+    std::unordered_map<const sc_core::sc_object*, resolution>::iterator it =
+            m_resolved.find(obj);
+    if (it != m_resolved.end()
+        && it->second.parent == obj->get_parent_object())
+      return *it->second.broker;
+  }
+
+  const sc_core::sc_object *org = obj;
+  std::map<const sc_core::sc_object*, cci_broker_if*>::iterator it;
   while (true) {
-    std::map<const sc_core::sc_object*, cci_broker_if*>::iterator it =
-            m_brokers.find(org);
-    if(it != m_brokers.end()) {
-      cci_broker_handle broker_handle=(it->second)->create_broker_handle(originator);
-      return broker_handle;
-    }
+    it = m_brokers.find(org);
+    if(it != m_brokers.end())
+      break;
     if (!org) {
       CCI_REPORT_ERROR("cci_broker_manager","No global broker found!");
       // Abort since no reasonable recovery when the exception is suppressed.
@@ -44,6 +61,16 @@ cci_broker_manager::get_broker(const cci_originator &originator)
     }
     org = org->get_parent_object();
   }
+
+  // memoize the resolution for all objects on the way up
+  for (const sc_core::sc_object* o = obj; o != org; ) {
+    const sc_core::sc_object* parent = o->get_parent_object();
+    resolution& r = m_resolved[o];
+    r.parent = parent;
+    r.broker = it->second;
+    o = parent;
+  }
+  return *it->second;
 }
 
 cci_broker_handle
@@ -54,6 +81,7 @@ cci_broker_manager::register_broker(cci_broker_if& broker)
     cci_broker_if* & broker_entry = m_brokers[obj]; // find broker position in registry
     if( !broker_entry ) {
         broker_entry = &broker; // store broker in registry
+        m_resolved.clear(); // resolutions below obj may have changed
     }
     if( &broker != broker_entry ) { // we already had a different entry!
         CCI_REPORT_ERROR("cci_broker_manager/register_broker",
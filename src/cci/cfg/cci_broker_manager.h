@@ -25,6 +25,7 @@
 #include "cci/cfg/cci_config_macros.h"
 #include "cci/cfg/cci_report_handler.h"
 #include <map>
+#include <unordered_map>
 
 CCI_OPEN_NAMESPACE_
 
@@ -71,9 +72,24 @@ private:
     }
 
 private:
+    /// Find the broker responsible for the given object (or the global one)
+    static cci_broker_if& find_broker(const sc_core::sc_object* obj);
+
     /// Public broker hierarchy
     static std::map<const sc_core::sc_object*, cci_broker_if*> m_brokers;
 
+    /// Resolved broker of an object
+    struct resolution
+    {
+      /// Parent object at the time of the resolution
+      const sc_core::sc_object* parent;
+      cci_broker_if* broker;
+    };
+
+    /// Cache of resolved brokers (cleared when a broker is registered)
+    static std::unordered_map<const sc_core::sc_object*, resolution>
+      m_resolved;
+
 };
 
 /// Returns a handle to the currently responsible broker
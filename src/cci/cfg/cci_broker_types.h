@@ -23,17 +23,16 @@
 #include "cci/core/cci_value.h"
 #include "cci/core/cci_filtered_range.h"
 #include "cci/cfg/cci_broker_callbacks.h"
+#include "cci/cfg/cci_param_handle_sequence.h"
 //
 #include <string>
 #include <utility> // std::pair
 
 CCI_OPEN_NAMESPACE_
 
-// forward declaration
-class cci_param_untyped_handle;
-
 /// CCI parameter filter iterator type
-typedef cci_filtered_range<cci_param_untyped_handle, cci_param_predicate>
+typedef cci_filtered_range<cci_param_untyped_handle, cci_param_predicate,
+                           cci_param_handle_sequence>
         cci_param_range;
 
 /// CCI value with parameter name pair type
@@ -26,29 +26,134 @@
 
 CCI_OPEN_NAMESPACE_
 
+///@cond CCI_HIDDEN_FROM_DOXYGEN
+namespace cci_impl {
+/// implementation defined value of a type-independent parameter event
+/**
+ * Refers to a typed value and converts it to a cci_value on the first
+ * access only, i.e. callbacks that do not look at the value do not pay
+ * for the conversion.  The referenced value has to outlive this object.
+ */
+class lazy_value
+{
+public:
+  typedef cci_value value_type;
+
+  explicit lazy_value(const value_type& v)
+    : m_value(&v), m_typed(NULL), m_pack(NULL), m_packed() {}
+
+  template<typename T>
+  explicit lazy_value(const T& v)
+    : m_value(NULL), m_typed(&v), m_pack(&pack<T>), m_packed() {}
+
+  /// converted value
+  const value_type& get() const
+  {
+    if (!m_value) {
+      m_pack(m_packed, m_typed);
+      m_value = &m_packed;
+    }
+    return *m_value;
+  }
+
+  operator const value_type&() const { return get(); }
+  const value_type* operator->() const { return &get(); }
+
+  /** @name cci_value_cref interface */
+  //@{
+  cci_value_category category() const { return get().category(); }
+  bool is_null()   const { return get().is_null(); }
+  bool is_bool()   const { return get().is_bool(); }
+  bool is_false()  const { return get().is_false(); }
+  bool is_true()   const { return get().is_true(); }
+  bool is_number() const { return get().is_number(); }
+  bool is_int()    const { return get().is_int(); }
+  bool is_uint()   const { return get().is_uint(); }
+  bool is_int64()  const { return get().is_int64(); }
+  bool is_uint64() const { return get().is_uint64(); }
+  bool is_double() const { return get().is_double(); }
+  bool is_string() const { return get().is_string(); }
+  bool is_map()    const { return get().is_map(); }
+  bool is_list()   const { return get().is_list(); }
+
+  bool     get_bool()   const { return get().get_bool(); }
+  int      get_int()    const { return get().get_int(); }
+  unsigned get_uint()   const { return get().get_uint(); }
+  int64    get_int64()  const { return get().get_int64(); }
+  uint64   get_uint64() const { return get().get_uint64(); }
+  double   get_double() const { return get().get_double(); }
+  double   get_number() const { return get().get_number(); }
+
+  cci_value_string_cref get_string() const { return get().get_string(); }
+  cci_value_list_cref   get_list()   const { return get().get_list(); }
+  cci_value_map_cref    get_map()    const { return get().get_map(); }
+
+  template<typename U>
+  typename value_converter_enable_if<U,bool>::type try_get(U& dst) const
+    { return get().try_get(dst); }
+  template<typename U>
+  typename value_converter_enable_if<U,U>::type get() const
+    { return get().template get<U>(); }
+
+  std::string to_json() const { return get().to_json(); }
+  //@}
+
+  friend bool operator==(const lazy_value& a, cci_value_cref b)
+    { return a.get() == b; }
+  friend bool operator==(cci_value_cref a, const lazy_value& b)
+    { return a == b.get(); }
+  friend bool operator!=(const lazy_value& a, cci_value_cref b)
+    { return !(a.get() == b); }
+  friend bool operator!=(cci_value_cref a, const lazy_value& b)
+    { return !(a == b.get()); }
+  friend std::ostream& operator<<(std::ostream& os, const lazy_value& v)
+    { return os << v.get(); }
+
+private:
+  lazy_value(const lazy_value&) /* = delete */;
+  lazy_value& operator=(const lazy_value&) /* = delete */;
+
+  template<typename T>
+  static void pack(value_type& dst, const void* src)
+    { dst.set(*static_cast<const T*>(src)); }
+
+  mutable const value_type* m_value;
+  const void* m_typed;
+  void (*m_pack)(value_type&, const void*);
+  mutable value_type m_packed;
+}; // class lazy_value
+} // namespace cci_impl
+///@endcond
+
 template<typename T = void>
 struct cci_param_write_event;
 
 /// Forward declaration
+class cci_param_if;
 class cci_param_untyped_handle;
 class cci_originator;
 
 /// Payload for type-independent pre write and post write callbacks
+/**
+ * The values are converted from the typed values of the parameter on their
+ * first access.  They can be used like (and bound to) constant cci_value
+ * references.
+ */
 template<>
 struct cci_param_write_event<void>
 {
   typedef cci_param_write_event type;
   typedef cci_value value_type;
 
-  cci_param_write_event( const value_type&     old_
-                       , const value_type&     new_
+  cci_param_write_event( const cci_impl::lazy_value& old_
+                       , const cci_impl::lazy_value& new_
                        , const cci_originator& orig_
                        , const cci_param_untyped_handle& handle_ );
 
   /// Old parameter value
-  const value_type& old_value;
+  const cci_impl::lazy_value& old_value;
   /// New parameter value
-  const value_type& new_value;
+  const cci_impl::lazy_value& new_value;
   /// Originator of new value
   const cci_originator& originator;
   /// Parameter handle
@@ -84,8 +189,8 @@ struct cci_param_write_event
     generic_type get() const { return wrapped_value; }
     explicit generic_wrap(const type& payload);
 
-    cci_value old_value;
-    cci_value new_value;
+    cci_impl::lazy_value old_value;
+    cci_impl::lazy_value new_value;
     typename cci_impl::remove_reference<generic_type>::type wrapped_value;
   }; // struct generic_wrap
 
@@ -95,18 +200,22 @@ template<typename T = void>
 struct cci_param_read_event;
 
 /// Payload for type-independent read callbacks
+/**
+ * The value is converted from the typed value of the parameter on its
+ * first access.
+ */
 template<>
 struct cci_param_read_event<void>
 {
     typedef cci_param_read_event type;
     typedef cci_value value_type;
 
-    cci_param_read_event( const value_type&     val_
+    cci_param_read_event( const cci_impl::lazy_value& val_
                         , const cci_originator& orig_
                         , const cci_param_untyped_handle& handle_ );
 
     /// Parameter value
-    const value_type& value;
+    const cci_impl::lazy_value& value;
     /// Originator of new value
     const cci_originator& originator;
     /// Parameter handle
@@ -140,7 +249,7 @@ struct cci_param_read_event
         generic_type get() const { return wrapped_value; }
         explicit generic_wrap(const type& payload);
 
-        cci_value value;
+        cci_impl::lazy_value value;
         typename cci_impl::remove_reference<generic_type>::type wrapped_value;
     }; // struct generic_wrap
 
@@ -255,10 +364,59 @@ protected:
 
 /* ------------------------------------------------------------------------ */
 
+/// Parameter access events, to be combined as a bit mask
+enum cci_param_event_mask
+{
+  CCI_PARAM_PRE_WRITE_EVENT  = 1,
+  CCI_PARAM_POST_WRITE_EVENT = 2,
+  CCI_PARAM_PRE_READ_EVENT   = 4,
+  CCI_PARAM_POST_READ_EVENT  = 8
+};
+
+/// Observer of parameter accesses
+/**
+ * A single observer can be attached to a parameter in addition to the
+ * regular callbacks (see cci_param_if::set_observer).  This allows a broker
+ * to dispatch the accesses of a whole subtree of parameters to its own
+ * subscriptions, without registering a callback in each parameter.
+ *
+ * The values are converted from the typed values on their first access
+ * (see cci_param_write_event<void>).
+ */
+struct cci_param_observer_if
+{
+  /// Parameter is about to be written, return false to reject the value
+  virtual bool pre_write( cci_param_if& param
+                        , const cci_impl::lazy_value& old_value
+                        , const cci_impl::lazy_value& new_value
+                        , const cci_originator& originator ) = 0;
+
+  /// Parameter has been written
+  virtual void post_write( cci_param_if& param
+                         , const cci_impl::lazy_value& old_value
+                         , const cci_impl::lazy_value& new_value
+                         , const cci_originator& originator ) = 0;
+
+  /// Parameter is about to be read
+  virtual void pre_read( cci_param_if& param
+                       , const cci_impl::lazy_value& value
+                       , const cci_originator& originator ) = 0;
+
+  /// Parameter has been read
+  virtual void post_read( cci_param_if& param
+                        , const cci_impl::lazy_value& value
+                        , const cci_originator& originator ) = 0;
+
+protected:
+  virtual ~cci_param_observer_if() {}
+};
+
+/* ------------------------------------------------------------------------ */
+
 inline
 cci_param_write_event<void>::
-  cci_param_write_event( const value_type&     old_
-                       , const value_type&     new_
+  cci_param_write_event( const cci_impl::lazy_value& old_
+                       , const cci_impl::lazy_value& new_
                        , const cci_originator& orig_
                        , const cci_param_untyped_handle& handle_ )
     : old_value(old_)
@@ -289,7 +447,7 @@ cci_param_write_event<T>::
 
 inline
 cci_param_read_event<void>::
-  cci_param_read_event( const value_type&     val_
+  cci_param_read_event( const cci_impl::lazy_value& val_
                       , const cci_originator& orig_
                       , const cci_param_untyped_handle& handle_ )
     : value(val_)
@@ -0,0 +1,182 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+#ifndef CCI_CFG_CCI_PARAM_HANDLE_SEQUENCE_H_INCLUDED_
+#define CCI_CFG_CCI_PARAM_HANDLE_SEQUENCE_H_INCLUDED_
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "cci/cfg/cci_originator.h"
+#include "cci/cfg/cci_param_untyped_handle.h"
+
+CCI_OPEN_NAMESPACE_
+
+// forward declaration
+class cci_param_if;
+
+/// Sequence of parameter handles
+/**
+ * Container type underlying a cci_param_range.  Copies of a sequence share
+ * the underlying elements, so that passing a sequence (or range) by value
+ * does not copy the handles.
+ *
+ * A sequence either holds a list of parameter handles or is @em lazy:
+ * a lazy sequence only refers to a (shared) list of parameters.  All
+ * elements of a lazy sequence are accessed through a single cursor, which
+ * is pointed to the accessed parameter without registering with it, i.e.
+ * accessing an element (e.g. to evaluate the predicate of a range) neither
+ * allocates nor modifies the parameter.  A registered handle is only
+ * created, when the element is copied.  Therefore, a reference obtained
+ * from a lazy sequence is only valid until the next element access (copy
+ * the handle to keep it).
+ *
+ * The broker marks the shared list stale, when one of its parameters is
+ * destroyed.  All elements of a stale sequence are invalid handles, i.e.
+ * accessing them is reported like accessing any other invalid handle.
+ */
+class cci_param_handle_sequence
+{
+    struct impl;
+
+public:
+    typedef cci_param_untyped_handle value_type;
+    typedef value_type&              reference;
+    typedef const value_type&        const_reference;
+    typedef value_type*              pointer;
+    typedef const value_type*        const_pointer;
+    typedef std::size_t              size_type;
+    typedef std::ptrdiff_t           difference_type;
+
+    /// Sequence iterator
+    class iterator
+    {
+        friend class cci_param_handle_sequence;
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef cci_param_handle_sequence::value_type      value_type;
+        typedef cci_param_handle_sequence::difference_type difference_type;
+        typedef cci_param_handle_sequence::pointer         pointer;
+        typedef cci_param_handle_sequence::reference       reference;
+
+        iterator() : m_impl(NULL), m_pos() {}
+
+        reference operator*() const  { return m_impl->at(m_pos); }
+        pointer   operator->() const { return &m_impl->at(m_pos); }
+
+        iterator& operator++() { ++m_pos; return *this; }
+        iterator& operator--() { --m_pos; return *this; }
+        iterator  operator++(int) { iterator ret(*this); ++m_pos; return ret; }
+        iterator  operator--(int) { iterator ret(*this); --m_pos; return ret; }
+
+        bool operator==(const iterator& that) const
+          { return m_pos == that.m_pos && m_impl == that.m_impl; }
+        bool operator!=(const iterator& that) const
+          { return !(*this == that); }
+
+    private:
+        iterator(impl* i, size_type pos)
+          : m_impl(i), m_pos(pos) {}
+
+        impl*     m_impl;
+        size_type m_pos;
+    };
+    typedef iterator const_iterator;
+
+    /// Parameter list shared by lazy sequences
+    struct param_list
+    {
+        param_list() : params(), valid(true) {}
+
+        std::vector<cci_param_if*> params;
+        /// Cleared by the broker, when one of the parameters is destroyed
+        bool valid;
+    };
+
+    /// Constructs an empty sequence
+    cci_param_handle_sequence()
+      : m_impl(new impl()) {}
+
+    /// Constructs a sequence of the given handles
+    cci_param_handle_sequence(std::vector<cci_param_untyped_handle> handles)
+      : m_impl(new impl())
+      { m_impl->handles.swap(handles); }
+
+    /// Constructs a lazy sequence
+    /**
+     * @param params     parameters to refer to (shared, not copied)
+     * @param originator originator of the accessed handles
+     */
+    cci_param_handle_sequence(
+        const std::shared_ptr<const param_list>& params,
+        const cci_originator& originator)
+      : m_impl(new impl())
+    {
+        m_impl->params = params;
+        m_impl->cursor.reset(new cci_param_untyped_handle(originator));
+    }
+
+    /// Returns true, if handles are materialized on access
+    bool is_lazy() const { return m_impl->is_lazy(); }
+
+    size_type size() const { return m_impl->size(); }
+    bool empty() const { return size() == 0; }
+
+    iterator begin() const { return iterator(m_impl.get(), 0); }
+    iterator end() const   { return iterator(m_impl.get(), size()); }
+
+    /// Access an element (materializes the handle of a lazy sequence)
+    reference at(size_type pos) const { return m_impl->at(pos); }
+
+private:
+    struct impl
+    {
+        ~impl()
+        {
+            if (cursor)
+                cursor->set_view(NULL);
+        }
+
+        bool is_lazy() const { return cursor.get() != NULL; }
+
+        size_type size() const
+          { return is_lazy() ? params->params.size() : handles.size(); }
+
+        reference at(size_type pos)
+        {
+            if (!is_lazy())
+                return handles.at(pos);
+            cci_param_if* param = params->params.at(pos);
+            // stale list, the parameter may have been destroyed already
+            cursor->set_view(params->valid ? param : NULL);
+            return *cursor;
+        }
+
+        std::vector<cci_param_untyped_handle>     handles;
+        std::shared_ptr<const param_list>         params;
+        std::unique_ptr<cci_param_untyped_handle> cursor;
+    };
+    std::shared_ptr<impl> m_impl;
+};
+
+CCI_CLOSE_NAMESPACE_
+
+#endif // CCI_CFG_CCI_PARAM_HANDLE_SEQUENCE_H_INCLUDED_
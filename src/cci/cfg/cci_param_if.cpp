@@ -52,6 +52,38 @@ void cci_param_if::preset_cci_value( const cci_value& value
   set_cci_value(value, originator);
 }
 
+void cci_param_if::set_observer( cci_param_observer_if*, int )
+{
+  // observers are not supported by default
+}
+
+bool cci_param_if::set_write_list( cci_impl::write_list* )
+{
+  // writes are not tracked by default
+  return false;
+}
+
+uint64 cci_param_if::get_write_generation() const
+{
+  // writes are not tracked by default
+  return 0;
+}
+
+const void* cci_param_if::pin_raw_value( const uint64*& ) const
+{
+  // no direct access by default, read through get_raw_value
+  return NULL;
+}
+
+cci_impl::staged_write_if*
+cci_param_if::stage_cci_value( const cci_value&, const void*
+                             , const cci_originator& )
+{
+  cci_report_handler::set_param_failed(
+    "Parameter does not support write batches.", __FILE__, __LINE__ );
+  return NULL;
+}
+
 void cci_param_if::invalidate_all_param_handles()
 {
   CCI_REPORT_FATAL( "DESTROY_PARAM"
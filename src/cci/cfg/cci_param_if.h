@@ -35,8 +35,99 @@
 CCI_OPEN_NAMESPACE_
 
 class cci_param_untyped_handle;
+class cci_param_write_batch;
 class cci_originator;
 
+///@cond CCI_HIDDEN_FROM_DOXYGEN
+namespace cci_impl {
+/// Write of a parameter, staged by a cci_param_write_batch
+struct staged_write_if
+{
+    virtual ~staged_write_if() {}
+
+    /// Exchange the current and the staged value (no callbacks)
+    virtual void apply() = 0;
+
+    /// Undo apply(), restoring the value and the write state of the
+    /// parameter (no callbacks)
+    virtual void rollback() = 0;
+
+    /// Invoke the post write callbacks (after apply)
+    virtual void notify() = 0;
+};
+
+struct write_list;
+
+/// Link of a parameter in the write_list of its broker
+struct write_node
+{
+    write_node() : list(), prev(), next(), param(), generation() {}
+
+    write_list*   list;
+    write_node*   prev;
+    write_node*   next;
+    cci_param_if* param;
+    /// Write generation that moved the node to the end of the list (never
+    /// less than the one of the parameter, which a rollback may restore)
+    uint64        generation;
+};
+
+/// Parameters of a broker, ordered by their latest write
+/**
+ * A write moves the node of the parameter to the end of the list, so the
+ * parameters written after a given generation are found by walking the
+ * list backwards while the node generations are greater than it.
+ */
+struct write_list
+{
+    write_list() : first(), last() {}
+
+    /// Append a node (with a generation not less than the last one)
+    void link(write_node& n, cci_param_if& p, uint64 generation)
+    {
+        n.list = this;
+        n.param = &p;
+        append(n, (last && last->generation > generation)
+                  ? last->generation : generation);
+    }
+
+    /// Remove a node
+    void unlink(write_node& n)
+    {
+        (n.prev ? n.prev->next : first) = n.next;
+        (n.next ? n.next->prev : last) = n.prev;
+        n.list = NULL;
+        n.prev = n.next = NULL;
+    }
+
+    /// Move a node to the end of the list after a write
+    void touch(write_node& n, uint64 generation)
+    {
+        if (&n != last) {
+            unlink(n);
+            n.list = this;
+            append(n, generation);
+        } else {
+            n.generation = generation;
+        }
+    }
+
+    write_node* first;
+    write_node* last;
+
+private:
+    void append(write_node& n, uint64 generation)
+    {
+        n.generation = generation;
+        n.prev = last;
+        n.next = NULL;
+        (last ? last->next : first) = &n;
+        last = &n;
+    }
+};
+} // namespace cci_impl
+///@endcond
+
 /**
  * @brief CCI configuration parameter interface
  *
@@ -60,6 +151,7 @@ class cci_originator;
 class cci_param_if : public cci_param_callback_if
 {
     friend class cci_param_untyped_handle;
+    friend class cci_param_write_batch;
 public:
 
     /// @name (Untyped) parameter value access
@@ -192,6 +284,14 @@ public:
     /// @copydoc cci_param_untyped::is_preset_value
     virtual bool is_preset_value() const = 0;
 
+    /// @copydoc cci_param_untyped::get_write_generation
+    /**
+     * The default implementation returns 0, i.e. writes are not tracked
+     * and the parameter is never reported as changed (see
+     * cci_broker_if::get_changed_param_handles).
+     */
+    virtual uint64 get_write_generation() const;
+
     ///@}
 
     ///@name Originator queries
@@ -255,6 +355,36 @@ public:
      */
     virtual bool reset() = 0;
 
+    /**
+     * Attach an observer to this parameter.
+     * @param observer observer to notify (NULL to detach)
+     * @param events   observed events (see cci_param_event_mask)
+     *
+     * Used by broker implementations to dispatch parameter accesses to
+     * subscriptions on whole parameter subtrees.  A parameter supports a
+     * single observer, which is notified after the regular callbacks.
+     *
+     * The default implementation ignores the observer, i.e. parameter
+     * implementations without observer support are not covered by
+     * subscriptions.
+     */
+    virtual void set_observer(cci_param_observer_if* observer, int events);
+
+    /**
+     * Link this parameter into the write list of a broker.
+     * @param list write list to link into (NULL to unlink)
+     * @return false, if writes of this parameter are not tracked
+     *
+     * Used by broker implementations to find the parameters written since
+     * a given generation without walking all parameters (see
+     * cci_broker_if::get_changed_param_handles).  A parameter is linked
+     * into at most one list, which is updated on every write.
+     *
+     * The default implementation ignores the list and returns false, i.e.
+     * brokers have to poll such parameters one by one.
+     */
+    virtual bool set_write_list(cci_impl::write_list* list);
+
 protected:
     /// helper function, returning an unknown/invalid originator
     cci_originator unknown_originator() const
@@ -346,6 +476,22 @@ private:
     /// @copydoc cci_param_typed::get_raw_default_value
     virtual const void *get_raw_default_value() const = 0;
 
+    /// @copydoc cci_param_typed::pin_raw_value
+    /**
+     * The default implementation returns NULL, i.e. pinned handles always
+     * read through the regular path (see cci_param_pinned_handle).
+     */
+    virtual const void *pin_raw_value(const uint64*& stamp) const;
+
+    /// @copydoc cci_param_typed::stage_cci_value
+    /**
+     * The default implementation reports, that the parameter can not be
+     * written by a cci_param_write_batch, and returns NULL.
+     */
+    virtual cci_impl::staged_write_if*
+    stage_cci_value(const cci_value &val, const void *pwd,
+                    const cci_originator &originator);
+
     /// @copydoc cci_param_untyped::add_param_handle
     virtual void add_param_handle(cci_param_untyped_handle* param_handle) = 0;
 
@@ -0,0 +1,103 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+#ifndef CCI_CFG_CCI_PARAM_PINNED_HANDLE_H_INCLUDED_
+#define CCI_CFG_CCI_PARAM_PINNED_HANDLE_H_INCLUDED_
+
+#include "cci/cfg/cci_param_typed_handle.h"
+
+CCI_OPEN_NAMESPACE_
+
+/**
+ * @brief Typed parameter handle with pinned read access
+ * @tparam T underlying type of given parameter
+ *
+ * A pinned handle caches a direct pointer to the value of the parameter,
+ * together with the access stamp of the parameter.  As long as the stamp
+ * is unchanged, a read is a pointer load and a compare, without invoking
+ * the parameter.  The stamp changes whenever the cached pointer may become
+ * invalid, i.e. when callbacks or locks change or the value is relocated
+ * (see cci_param_shared_storage).  The pointer is then pinned again with
+ * the next read.
+ *
+ * While the parameter has read callbacks, reads take the regular path
+ * (see cci_param_typed_handle::get_value).
+ *
+ * Intended for frequent reads in hot simulation loops.
+ */
+template<typename T>
+class cci_param_pinned_handle : public cci_param_typed_handle<T>
+{
+public:
+    /// The parameter's value type.
+    typedef T value_type;
+
+    /**
+     * @brief Constructor to create a pinned parameter handle
+     * @param untyped Untyped parameter handle to restore type information on
+     *
+     * @see cci_param_typed_handle(cci_param_untyped_handle)
+     */
+    explicit cci_param_pinned_handle(cci_param_untyped_handle untyped)
+      : cci_param_typed_handle<T>(untyped)
+      , m_pinned_param(NULL), m_stamp(NULL), m_pinned_stamp(), m_value(NULL) {}
+
+    /// Convenience shortcut to read the stored value
+    const value_type& operator*() const
+      { return get_value(); }
+
+    ///Gets the stored value
+    const value_type& get_value() const
+    {
+        if (m_value && this->get_param() == m_pinned_param
+            && *m_stamp == m_pinned_stamp)
+            return *m_value;
+        return pin_value();
+    }
+
+private:
+    const value_type& pin_value() const;
+
+    /// Pinned parameter (the stamp is only valid while it is referenced)
+    mutable const cci_param_if* m_pinned_param;
+    mutable const uint64*       m_stamp;
+    mutable uint64              m_pinned_stamp;
+    mutable const value_type*   m_value;
+};
+
+template <typename T>
+const T& cci_param_pinned_handle<T>::pin_value() const
+{
+    const uint64* stamp = NULL;
+    const void* value = this->pin_raw_value(stamp);
+    if (!value) {
+        // read callbacks present, take the regular path
+        m_value = NULL;
+        return cci_param_typed_handle<T>::get_value();
+    }
+    m_pinned_param = this->get_param();
+    m_stamp = stamp;
+    m_pinned_stamp = *stamp;
+    m_value = static_cast<const value_type*>(value);
+    return *m_value;
+}
+
+CCI_CLOSE_NAMESPACE_
+
+#endif // CCI_CFG_CCI_PARAM_PINNED_HANDLE_H_INCLUDED_
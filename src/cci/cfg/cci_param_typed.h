@@ -25,7 +25,10 @@
 #include "cci/cfg/cci_report_handler.h"
 #include "cci/cfg/cci_broker_manager.h"
 
+#include <memory>
 #include <sstream> //std::stringstream
+#include <type_traits>
+#include <utility>
 
 /**
  * @author Enrico Galli, Intel
@@ -39,16 +42,58 @@ class cci_param_typed_handle;
 
 ///@cond CCI_HIDDEN_FROM_DOXYGEN
 namespace cci_impl {
-/// implementation defined helper to set/reset a boolean flag
-struct scoped_true {
-    explicit scoped_true(bool& ref) : ref_(ref) { ref_ = true; }
-    ~scoped_true() { ref_ = false; }
+/// implementation defined reference-counted, copy-on-write value storage
+/**
+ * Copies share the stored value, assigning a new value allocates a new
+ * buffer (the value itself is never modified in place).
+ */
+template<typename T>
+class shared_value
+{
+public:
+    explicit shared_value(const T& v)
+      : m_ptr(std::make_shared<const T>(v)) {}
+    explicit shared_value(T&& v)
+      : m_ptr(std::make_shared<const T>(CCI_MOVE_(v))) {}
+
+    shared_value& operator=(const T& v)
+      { m_ptr = std::make_shared<const T>(v); return *this; }
+    shared_value& operator=(T&& v)
+      { m_ptr = std::make_shared<const T>(CCI_MOVE_(v)); return *this; }
+
+    const T& get() const { return *m_ptr; }
+
+    bool operator==(const shared_value& that) const
+      { return m_ptr == that.m_ptr || *m_ptr == *that.m_ptr; }
+
 private:
-    bool& ref_;
-}; // class scoped_true
+    std::shared_ptr<const T> m_ptr;
+}; // class shared_value
+
+template<typename T>
+const T& stored_value(const T& v) { return v; }
+template<typename T>
+const T& stored_value(const shared_value<T>& v) { return v.get(); }
 }  // namespace cci_impl
 ///@endcond
 
+/// Storage policy of the values of typed parameters
+/**
+ * By default, a typed parameter stores its current and its default value
+ * as separate copies.  For large value types (e.g. memory images or
+ * tables), this trait can be specialized to store the values in shared,
+ * reference-counted buffers instead, which are copied on write only:
+ * @code
+ * namespace cci {
+ * template<> struct cci_param_shared_storage<memory_image> : std::true_type {};
+ * }
+ * @endcode
+ * The default and the current value then share a single buffer until the
+ * parameter is written.
+ */
+template<typename T>
+struct cci_param_shared_storage : std::false_type {};
+
 /// Parameter class, internally forwarding calls to the implementation
 /**
  * The implementation is in file cci_param_typed.hpp, which has to be included
@@ -81,6 +126,13 @@ public:
      */
     cci_param_typed& operator= (const value_type & rhs);
 
+    ///Assigns parameter a new value (moved from rhs)
+    /**
+     * @param rhs New value to assign
+     * @return reference to this object
+     */
+    cci_param_typed& operator= (value_type && rhs);
+
     ///Conversion operator to be able use cci_param_typed as a regular object
     operator const value_type& () const;
 
@@ -97,6 +149,33 @@ public:
      */
     void set_value(const value_type & value, const void * pwd);
 
+    ///Sets the stored value to a new value (moved from value)
+    /**
+     * The previous value is only kept while post-write callbacks need it,
+     * i.e. a write without callbacks moves the value only once.
+     *
+     * @param value new value to assign
+     */
+    void set_value(value_type&& value);
+    ///Sets the stored value to a new value (moved from value)
+    /**
+     * @param value new value to assign
+     * @param pwd Password needed to unlock the param, ideally any pointer
+     * address known only by the locking entity, default = NULL
+     */
+    void set_value(value_type&& value, const void * pwd);
+
+    ///Sets the stored value to a value constructed from the given arguments
+    /**
+     * Equivalent to set_value(value_type(args...)), avoiding any copy of
+     * the new value.
+     *
+     * @param args constructor arguments of the new value
+     */
+    template<typename... Args>
+    void emplace_value(Args&&... args)
+      { set_value(value_type(CCI_FORWARD_(Args, args)...)); }
+
     ///Get the value passed in via constructor
     const value_type & get_default_value() const;
 
@@ -429,11 +508,32 @@ public:
       { destroy(m_broker_handle); }
 
 protected:
+    /// Storage type of the values (see cci_param_shared_storage)
+    typedef typename std::conditional<cci_param_shared_storage<T>::value,
+                                      cci_impl::shared_value<T>,
+                                      T>::type storage_type;
+
     /// Value
-    value_type m_value;
+    storage_type m_value;
 
     /// Default value
-    value_type m_default_value;
+    storage_type m_default_value;
+
+    /// Current value (without invoking callbacks)
+    const value_type& current_value() const
+      { return cci_impl::stored_value(m_value); }
+
+    /// Record a write of the value
+    /**
+     * Advances the write generation.  Shared values are relocated by
+     * writes, which invalidates the pinned values as well.
+     */
+    void value_written()
+    {
+        update_write_generation();
+        if (cci_param_shared_storage<T>::value)
+            update_access_stamp();
+    }
 
 private:
     ///@copydoc cci_param_if::preset_cci_value
@@ -449,34 +549,105 @@ private:
     /// @copydoc cci_param_if::get_raw_default_value
     virtual const void *get_raw_default_value() const;
 
+    /// Pin the value for direct reads
+    /**
+     * @param[out] stamp location of the access stamp of this parameter,
+     *                   the returned pointer is valid as long as the stamp
+     *                   and the parameter are unchanged
+     * @return pointer to the value, or NULL if the value cannot be read
+     *         directly (i.e. read callbacks have to be invoked)
+     */
+    virtual const void *pin_raw_value(const uint64*& stamp) const;
+
+    /// Stage a write of a cci_param_write_batch
+    /**
+     * Performs all checks of set_cci_value (mutability, lock, conversion
+     * and pre write callbacks), without writing the value.
+     *
+     * @return staged write (owned by the caller), or NULL if a check failed
+     */
+    virtual cci_impl::staged_write_if*
+    stage_cci_value(const cci_value &val, const void *pwd,
+                    const cci_originator &originator);
+
+    class staged_write;
+
+    /// Callback handle to invoke for a callback object
+    /**
+     * Converts the registered callback into a handle of the typed
+     * signature (adapting untyped callbacks) on its first dispatch, so
+     * that further dispatches need neither run-time type checks nor
+     * conversions.
+     */
+    template<typename Handle, typename CallbackObj>
+    static const cci_callback_untyped_handle&
+    resolved_callback(CallbackObj& cb)
+    {
+        if (!cb.resolved) {
+            cb.invoker = typename Handle::type(cb.callback);
+            cb.resolved = true;
+        }
+        return cb.invoker;
+    }
+
+    /// Check mutability and lock state before a write
+    bool write_allowed(const void *pwd);
+
+    /// Write a new value, copied or moved from value (if allowed)
+    template<typename V>
+    void write_value(V&& value, const void *pwd,
+                     const cci_originator &originator);
+
+    /// Store a new value, keeping the old value only if needed
+    template<typename V>
+    void store_value(V&& value, const cci_originator &originator);
+
+    /// Old value before a write from a non-const rvalue (moved out)
+    storage_type take_old_value(std::false_type)
+      { return CCI_MOVE_(m_value); }
+
+    /// Old value before any other write (copied, the source may be m_value)
+    storage_type take_old_value(std::true_type) const
+      { return m_value; }
+
+    /// Returns true, if the old value is needed after a write
+    bool has_post_write_observers() const
+    {
+        return !m_post_write_callbacks.vec.empty()
+            || (m_observed_events & CCI_PARAM_POST_WRITE_EVENT);
+    }
+
     /// Pre write callback
     bool
-    pre_write_callback(value_type value,
+    pre_write_callback(const value_type& value,
                        const cci_originator &originator) const
     {
         // Already locked, skip nested invocation
         if (m_pre_write_callbacks.oncall)
             return false;
 
-        // Lock the tag to prevent nested callback
-        cci_impl::scoped_true oncall( m_pre_write_callbacks.oncall );
+        // Lock the tag to prevent nested callback (callbacks unregistered
+        // meanwhile are kept alive until the end of the scope)
+        callback_obj_vector<pre_write_callback_obj_t>::dispatch_scope
+          oncall( m_pre_write_callbacks );
 
         bool result = true;
         // Validate write callbacks
         for (unsigned i = 0; i < m_pre_write_callbacks.vec.size(); ++i) {
-            typename cci_param_pre_write_callback_handle<value_type>::type
-                    typed_pre_write_cb(
-                    m_pre_write_callbacks.vec[i].callback);
+            pre_write_callback_obj_t& cb = m_pre_write_callbacks.vec[i];
+            if (cb.removed)
+                continue;
 
-            // Prepare parameter handle for callback event
-            cci_param_untyped_handle param_handle =
-                    create_param_handle(m_pre_write_callbacks.vec[i].originator);
+            const cci_callback_untyped_handle& typed_pre_write_cb =
+              resolved_callback<
+                cci_param_pre_write_callback_handle<value_type> >(cb);
 
             // Write callback payload
             const cci_param_write_event<value_type>
-              ev(m_value, value, originator, param_handle);
+              ev(current_value(), value, originator, *cb.param_handle);
 
-            if (!typed_pre_write_cb.invoke(ev)) {
+            if (!typed_pre_write_cb.template unchecked_invoke<bool,
+                    const cci_param_write_event<value_type>&>(ev)) {
                 // Write denied
                 cci_report_handler::set_param_failed(
                         "Value rejected by callback.", __FILE__, __LINE__);
@@ -484,6 +655,18 @@ private:
             }
         }
 
+        // Observer (values converted on demand)
+        if (m_observed_events & CCI_PARAM_PRE_WRITE_EVENT) {
+            const cci_impl::lazy_value old_cci_value(current_value());
+            const cci_impl::lazy_value new_cci_value(value);
+            if (!m_observer->pre_write(observed_param(), old_cci_value,
+                                       new_cci_value, originator)) {
+                cci_report_handler::set_param_failed(
+                        "Value rejected by callback.", __FILE__, __LINE__);
+                result = false;
+            }
+        }
+
         return result;
     }
 
@@ -496,26 +679,38 @@ private:
         if (m_post_write_callbacks.oncall)
             return;
 
-        // Lock the tag to prevent nested callback
-        cci_impl::scoped_true oncall( m_post_write_callbacks.oncall );
+        // Lock the tag to prevent nested callback (callbacks unregistered
+        // meanwhile are kept alive until the end of the scope)
+        callback_obj_vector<post_write_callback_obj_t>::dispatch_scope
+          oncall( m_post_write_callbacks );
 
         // Write callbacks
         for (unsigned i = 0; i < m_post_write_callbacks.vec.size(); ++i) {
-            typename cci_param_post_write_callback_handle<value_type>::type
-                    typed_post_write_cb(m_post_write_callbacks.vec[i].callback);
-            if (typed_post_write_cb.valid()) {
+            post_write_callback_obj_t& cb = m_post_write_callbacks.vec[i];
+            if (cb.removed)
+                continue;
 
-                // Prepare parameter handle for callback event
-                cci_param_untyped_handle param_handle = create_param_handle(
-                        m_post_write_callbacks.vec[i].originator);
+            const cci_callback_untyped_handle& typed_post_write_cb =
+              resolved_callback<
+                cci_param_post_write_callback_handle<value_type> >(cb);
+            if (typed_post_write_cb.valid()) {
 
                 // Write callback payload
                 const cci_param_write_event<value_type>
-                  ev(old_value, new_value, originator, param_handle);
+                  ev(old_value, new_value, originator, *cb.param_handle);
 
-                typed_post_write_cb.invoke(ev);
+                typed_post_write_cb.template unchecked_invoke<void,
+                    const cci_param_write_event<value_type>&>(ev);
             }
         }
+
+        // Observer (values converted on demand)
+        if (m_observed_events & CCI_PARAM_POST_WRITE_EVENT) {
+            const cci_impl::lazy_value old_cci_value(old_value);
+            const cci_impl::lazy_value new_cci_value(new_value);
+            m_observer->post_write(observed_param(), old_cci_value,
+                                   new_cci_value, originator);
+        }
     }
 
     /// Pre read callback
@@ -526,26 +721,36 @@ private:
         if(m_pre_read_callbacks.oncall)
           return;
 
-        // Lock the tag to prevent nested callback
-        cci_impl::scoped_true oncall( m_pre_read_callbacks.oncall );
+        // Lock the tag to prevent nested callback (callbacks unregistered
+        // meanwhile are kept alive until the end of the scope)
+        callback_obj_vector<pre_read_callback_obj_t>::dispatch_scope
+          oncall( m_pre_read_callbacks );
 
         // Read callbacks
         for (unsigned i = 0; i < m_pre_read_callbacks.vec.size(); ++i) {
-            typename cci_param_pre_read_callback_handle<value_type>::type
-                    typed_pre_read_cb(m_pre_read_callbacks.vec[i].callback);
-            if (typed_pre_read_cb.valid()) {
+            pre_read_callback_obj_t& cb = m_pre_read_callbacks.vec[i];
+            if (cb.removed)
+                continue;
 
-                // Prepare parameter handle for callback event
-                cci_param_untyped_handle param_handle = create_param_handle(
-                        m_pre_read_callbacks.vec[i].originator);
+            const cci_callback_untyped_handle& typed_pre_read_cb =
+              resolved_callback<
+                cci_param_pre_read_callback_handle<value_type> >(cb);
+            if (typed_pre_read_cb.valid()) {
 
                 // Read callback payload
                 const cci_param_read_event<value_type>
-                  ev(value, originator, param_handle);
+                  ev(value, originator, *cb.param_handle);
 
-                typed_pre_read_cb.invoke(ev);
+                typed_pre_read_cb.template unchecked_invoke<void,
+                    const cci_param_read_event<value_type>&>(ev);
             }
         }
+
+        // Observer (value converted on demand)
+        if (m_observed_events & CCI_PARAM_PRE_READ_EVENT) {
+            const cci_impl::lazy_value cur_cci_value(value);
+            m_observer->pre_read(observed_param(), cur_cci_value, originator);
+        }
     }
 
     /// Post read callback
@@ -556,28 +761,42 @@ private:
         if(m_post_read_callbacks.oncall)
             return;
 
-        // Lock the tag to prevent nested callback
-        cci_impl::scoped_true oncall( m_post_read_callbacks.oncall );
+        // Lock the tag to prevent nested callback (callbacks unregistered
+        // meanwhile are kept alive until the end of the scope)
+        callback_obj_vector<post_read_callback_obj_t>::dispatch_scope
+          oncall( m_post_read_callbacks );
 
         // Read callbacks
         for (unsigned i = 0; i < m_post_read_callbacks.vec.size(); ++i) {
-            typename cci_param_post_read_callback_handle<value_type>::type
-                    typed_pre_read_cb(m_post_read_callbacks.vec[i].callback);
-            if (typed_pre_read_cb.valid()) {
+            post_read_callback_obj_t& cb = m_post_read_callbacks.vec[i];
+            if (cb.removed)
+                continue;
 
-                // Prepare parameter handle for callback event
-                cci_param_untyped_handle param_handle = create_param_handle(
-                        m_post_read_callbacks.vec[i].originator);
+            const cci_callback_untyped_handle& typed_post_read_cb =
+              resolved_callback<
+                cci_param_post_read_callback_handle<value_type> >(cb);
+            if (typed_post_read_cb.valid()) {
 
                 // Read callback payload
                 const cci_param_read_event<value_type>
-                  ev(value, originator, param_handle);
+                  ev(value, originator, *cb.param_handle);
 
-                typed_pre_read_cb.invoke(ev);
+                typed_post_read_cb.template unchecked_invoke<void,
+                    const cci_param_read_event<value_type>&>(ev);
             }
         }
+
+        // Observer (value converted on demand)
+        if (m_observed_events & CCI_PARAM_POST_READ_EVENT) {
+            const cci_impl::lazy_value cur_cci_value(value);
+            m_observer->post_read(observed_param(), cur_cci_value, originator);
+        }
     }
 
+    /// Parameter passed to the observer
+    cci_param_if& observed_param() const
+      { return *const_cast<cci_param_typed*>(this); }
+
 cci_broker_handle find_broker_convenience(const cci_originator &originator)
     {
       if (!sc_core::sc_get_current_object()) {
@@ -605,6 +824,14 @@ cci_param_typed<T, TM>::operator=(const T& rhs)
     return *this;
 }
 
+template <typename T, cci_param_mutable_type TM>
+cci_param_typed<T, TM>&
+cci_param_typed<T, TM>::operator=(T&& rhs)
+{
+    set_value(CCI_MOVE_(rhs));
+    return *this;
+}
+
 template <typename T, cci_param_mutable_type TM>
 cci_param_typed<T, TM>::operator const T&() const
 {
@@ -617,7 +844,7 @@ const T& cci_param_typed<T, TM>::get_value() const
   if (cci_param_untyped::fast_read) {
     // this is totally safe, there are no callbacks, and the originator is only
     // used by the callbacks
-    return m_value;
+    return current_value();
   }
   return get_value(get_originator());
 }
@@ -633,41 +860,50 @@ void cci_param_typed<T, TM>::set_raw_value(const void* value,
                                            const void *pwd,
                                            const cci_originator& originator)
 {
-  const value_type& new_value = *static_cast<const value_type*>(value);
+  write_value(*static_cast<const value_type*>(value), pwd, originator);
+}
 
+template <typename T, cci_param_mutable_type TM>
+bool cci_param_typed<T, TM>::write_allowed(const void *pwd)
+{
   if (!this->set_cci_value_allowed(TM))
-    return;
+    return false;
 
   if(!pwd) {
     if (cci_param_untyped::is_locked()) {
       cci_report_handler::set_param_failed("Parameter locked.", __FILE__, __LINE__);
-      return;
+      return false;
     }
   } else {
     if (pwd != m_lock_pwd) {
       cci_report_handler::set_param_failed("Wrong key.", __FILE__, __LINE__);
-      return;
+      return false;
     }
   }
+  return true;
+}
 
-  if (!pre_write_callback(new_value, originator))
+template <typename T, cci_param_mutable_type TM>
+template <typename V>
+void cci_param_typed<T, TM>::write_value(V&& new_value,
+                                         const void *pwd,
+                                         const cci_originator& originator)
+{
+  if (!write_allowed(pwd))
     return;
 
-  // Actual write
-  value_type old_value = m_value;
-  m_value = new_value;
-
-  // Update value's origin
-  m_value_origin = originator;
+  if (!pre_write_callback(new_value, originator))
+    return;
 
-  // Write callback(s)
-  post_write_callback(old_value, new_value, originator);
+  store_value(CCI_FORWARD_(V, new_value), originator);
 
   cci_param_untyped::fast_write =
     TM == CCI_MUTABLE_PARAM &&
     !cci_param_untyped::is_locked() &&
     m_pre_write_callbacks.vec.size()==0 &&
     m_post_write_callbacks.vec.size()==0 &&
+    !(m_observed_events &
+      (CCI_PARAM_PRE_WRITE_EVENT | CCI_PARAM_POST_WRITE_EVENT)) &&
     originator==m_originator;
 }
 
@@ -680,6 +916,7 @@ void cci_param_typed<T, TM>::set_value(const T& value)
   // the owner of the param, hence the originator must be m_originator.
   if (cci_param_untyped::fast_write) {
     m_value = value;
+    value_written();
   } else {
     set_raw_value(&value, NULL, get_originator());
   }
@@ -691,21 +928,82 @@ void cci_param_typed<T, TM>::set_value(const T& value, const void *pwd)
     set_raw_value(&value, pwd, get_originator());
 }
 
+template <typename T, cci_param_mutable_type TM>
+void cci_param_typed<T, TM>::set_value(T&& value)
+{
+  // see set_value(const T&)
+  if (cci_param_untyped::fast_write) {
+    m_value = CCI_MOVE_(value);
+    value_written();
+  } else {
+    write_value(CCI_MOVE_(value), NULL, get_originator());
+  }
+}
+
+template <typename T, cci_param_mutable_type TM>
+void cci_param_typed<T, TM>::set_value(T&& value, const void *pwd)
+{
+    write_value(CCI_MOVE_(value), pwd, get_originator());
+}
+
+template <typename T, cci_param_mutable_type TM>
+template <typename V>
+void cci_param_typed<T, TM>::store_value(V&& new_value,
+                                         const cci_originator& originator)
+{
+  if (!has_post_write_observers()) {
+    // Actual write
+    m_value = CCI_FORWARD_(V, new_value);
+    value_written();
+    // Update value's origin
+    m_value_origin = originator;
+    return;
+  }
+
+  // Actual write, keeping the old value for the callbacks
+  typedef std::integral_constant<bool,
+    std::is_lvalue_reference<V>::value ||
+    std::is_const<typename std::remove_reference<V>::type>::value> may_alias;
+  storage_type old_value(take_old_value(may_alias()));
+  m_value = CCI_FORWARD_(V, new_value);
+  value_written();
+
+  // Update value's origin
+  m_value_origin = originator;
+
+  // Write callback(s)
+  post_write_callback(cci_impl::stored_value(old_value), current_value(),
+                      originator);
+}
+
 template <typename T, cci_param_mutable_type TM>
 const void* cci_param_typed<T, TM>::get_raw_value(
         const cci_originator &originator) const
 {
-    pre_read_callback(m_value, originator);
-    const void *v = &m_value;
-    post_read_callback(m_value, originator);
+    pre_read_callback(current_value(), originator);
+    const void *v = &current_value();
+    post_read_callback(current_value(), originator);
 
     const_cast<cci_param_typed<T,TM>* >(this)->cci_param_untyped::fast_read =
         m_pre_read_callbacks.vec.size()==0 &&
-        m_post_read_callbacks.vec.size()==0;
+        m_post_read_callbacks.vec.size()==0 &&
+        !(m_observed_events &
+          (CCI_PARAM_PRE_READ_EVENT | CCI_PARAM_POST_READ_EVENT));
 
     return v;
 }
 
+template <typename T, cci_param_mutable_type TM>
+const void* cci_param_typed<T, TM>::pin_raw_value(const uint64*& stamp) const
+{
+    stamp = &m_access_stamp;
+    if (!m_pre_read_callbacks.vec.empty() || !m_post_read_callbacks.vec.empty()
+        || (m_observed_events &
+            (CCI_PARAM_PRE_READ_EVENT | CCI_PARAM_POST_READ_EVENT)))
+        return NULL;
+    return &current_value();
+}
+
 template <typename T, cci_param_mutable_type TM>
 cci_param_data_category cci_param_typed<T, TM>::get_data_category() const
 {
@@ -743,7 +1041,7 @@ template <typename T, cci_param_mutable_type TM>
 const typename cci_param_typed<T, TM>::value_type&
 cci_param_typed<T, TM>::get_default_value() const
 {
-    return this->m_default_value;
+    return cci_impl::stored_value(this->m_default_value);
 }
 
 template <typename T, cci_param_mutable_type TM>
@@ -758,27 +1056,85 @@ void cci_param_typed<T, TM>::set_cci_value(const cci_value& val,
                                            const cci_originator& originator)
 {
     value_type v = val.get<value_type>();
-    set_raw_value(&v, pwd, originator);
+    write_value(CCI_MOVE_(v), pwd, originator);
+}
+
+/// Write staged by a cci_param_write_batch
+template <typename T, cci_param_mutable_type TM>
+class cci_param_typed<T, TM>::staged_write : public cci_impl::staged_write_if
+{
+public:
+    staged_write(cci_param_typed& param, value_type&& value,
+                 const cci_originator& originator)
+      : m_param(param), m_value(CCI_MOVE_(value)), m_origin(originator)
+      , m_generation(), m_access_stamp(), m_fast_write() {}
+
+    void apply()
+    {
+        m_generation = m_param.m_write_generation;
+        m_access_stamp = m_param.m_access_stamp;
+        m_fast_write = m_param.fast_write;
+
+        using std::swap;
+        swap(m_param.m_value, m_value);
+        swap(m_param.m_value_origin, m_origin);
+        // the fast write path assumes the owner wrote the value
+        m_param.fast_write = false;
+        m_param.value_written();
+    }
+
+    void rollback()
+    {
+        using std::swap;
+        swap(m_param.m_value, m_value);
+        swap(m_param.m_value_origin, m_origin);
+        // the value is back in place, it has never been observed
+        m_param.m_write_generation = m_generation;
+        m_param.m_access_stamp = m_access_stamp;
+        m_param.fast_write = m_fast_write;
+    }
+
+    void notify()
+    {
+        // the staged value holds the old value after apply
+        m_param.post_write_callback(cci_impl::stored_value(m_value),
+                                    m_param.current_value(),
+                                    m_param.m_value_origin);
+    }
+
+private:
+    cci_param_typed& m_param;
+    storage_type     m_value;
+    cci_originator   m_origin;
+
+    /// write state of the parameter before apply()
+    uint64           m_generation;
+    uint64           m_access_stamp;
+    bool             m_fast_write;
+};
+
+template <typename T, cci_param_mutable_type TM>
+cci_impl::staged_write_if*
+cci_param_typed<T, TM>::stage_cci_value(const cci_value& val,
+                                        const void *pwd,
+                                        const cci_originator& originator)
+{
+    value_type v = val.get<value_type>();
+    if (!write_allowed(pwd) || !pre_write_callback(v, originator))
+        return NULL;
+    return new staged_write(*this, CCI_MOVE_(v), originator);
 }
 
 template <typename T, cci_param_mutable_type TM>
 void cci_param_typed<T, TM>::preset_cci_value(const cci_value& val,
                                               const cci_originator& originator)
 {
-    value_type old_value = m_value;
     value_type new_value = val.get<value_type>();
 
     if (!pre_write_callback(new_value, originator))
       return;
 
-    // Actual write
-    m_value = new_value;
-
-    // Update value's origin
-    m_value_origin = originator;
-
-    // Write callback(s)
-    post_write_callback(old_value, new_value, originator);
+    store_value(CCI_MOVE_(new_value), originator);
 }
 
 template <typename T, cci_param_mutable_type TM>
@@ -790,7 +1146,7 @@ cci_param_typed<T, TM>::get_cci_value(const cci_originator& originator) const
 
 template <typename T, cci_param_mutable_type TM>
 cci_value cci_param_typed<T, TM>::get_default_cci_value() const {
-    return cci_value(m_default_value);
+    return cci_value(get_default_value());
 }
 
 template <typename T, cci_param_mutable_type TM>
@@ -807,7 +1163,7 @@ bool cci_param_typed<T, TM>::is_preset_value() const
     cci_value init_value = m_broker_handle.get_preset_cci_value(name());
     T i;
     if (init_value.try_get<T>(i)) {
-      return i == m_value;
+      return i == current_value();
     }
   }
   return false;
@@ -905,7 +1261,7 @@ template <typename T, cci_param_mutable_type TM>                               \
 cci_param_typed<T, TM>::cci_param_typed signature                              \
 : cci_param_untyped(name, name_type, broker, desc, originator),                \
   m_value(default_value),                                                      \
-  m_default_value(default_value)                                               \
+  m_default_value(m_value)                                                     \
 {                                                                              \
     this->init(m_broker_handle);                                               \
 }
@@ -971,14 +1327,16 @@ bool cci_param_typed<T, TM>::reset()
         return false;
 
     // Actual write
-    value_type old_value = m_value;
-    m_value = get_default_value();
+    storage_type old_value = m_value;
+    m_value = m_default_value;
+    value_written();
 
     // Update value's origin
     m_value_origin = m_originator;
 
     // Write callback(s)
-    post_write_callback(old_value, get_default_value(), m_originator);
+    post_write_callback(cci_impl::stored_value(old_value),
+                        get_default_value(), m_originator);
   }
   return true;
 }
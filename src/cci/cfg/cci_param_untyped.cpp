@@ -32,6 +32,15 @@
 
 CCI_OPEN_NAMESPACE_
 
+uint64 cci_param_untyped::last_write_generation = 0;
+
+///@cond CCI_HIDDEN_FROM_DOXYGEN
+namespace cci_impl {
+/// next access stamp, shared by all parameters
+static uint64 next_access_stamp = 0;
+} // namespace cci_impl
+///@endcond
+
 cci_param_untyped::cci_param_untyped(const std::string& name,
                                      cci_name_type name_type,
                                      cci_broker_handle broker_handle,
@@ -39,10 +48,15 @@ cci_param_untyped::cci_param_untyped(const std::string& name,
                                      const cci_originator& originator)
     : m_description(desc), m_lock_pwd(NULL),
       m_broker_handle(broker_handle), m_value_origin(originator),
-      m_originator(originator), fast_read(false),fast_write(false)
+      m_originator(originator), m_observer(NULL), m_observed_events(0),
+      m_param_handles(NULL),
+      fast_read(false),fast_write(false),
+      m_access_stamp(++cci_impl::next_access_stamp),
+      m_write_generation(++last_write_generation)
 {
+    std::string full_name;
     if(name_type == CCI_ABSOLUTE_NAME) {
-        m_name = name;
+        full_name = name;
     } else {
         sc_core::sc_object* current_obj = sc_core::sc_get_current_object();
         for (sc_core::sc_process_handle current_proc(current_obj);
@@ -51,19 +65,21 @@ cci_param_untyped::cci_param_untyped(const std::string& name,
             current_obj = current_proc.get_parent_object(); 
         }
         if(current_obj) {
-            m_name = std::string(current_obj->name()) +
+            full_name = std::string(current_obj->name()) +
                 sc_core::SC_HIERARCHY_CHAR + name;
         } else {
-            m_name = name;
+            full_name = name;
         }
     }
 
     // Handle name collision and destruction / resurrection
-    std::string unique_name = std::string(cci_gen_unique_name(m_name.c_str()));
-    if (unique_name != m_name
-        && (sc_core::sc_hierarchical_name_exists(m_name.c_str())
-            || broker_handle.has_preset_value(m_name))) {
-        m_name = unique_name;
+    const char* unique_name = cci_gen_unique_name(full_name.c_str());
+    if (full_name != unique_name
+        && (sc_core::sc_hierarchical_name_exists(full_name.c_str())
+            || broker_handle.has_preset_value(full_name))) {
+        m_name = cci_name_atom(unique_name);
+    } else {
+        m_name = cci_name_atom(full_name);
     }
 }
 
@@ -71,9 +87,12 @@ cci_param_untyped::~cci_param_untyped()
 {
     // should have been invalidated from within typed implementation
     // (through call to cci_param_if::destroy)
-    sc_assert( m_param_handles.empty() );
+    sc_assert( m_param_handles == NULL );
 
-    if(!m_name.empty()) {
+    if( m_write_node.list )
+        m_write_node.list->unlink(m_write_node);
+
+    if(!m_name.is_null()) {
         cci_unregister_name(name());
     }
 }
@@ -108,6 +127,11 @@ bool cci_param_untyped::is_preset_value() const
   return init_value == get_cci_value(m_originator);
 }
 
+uint64 cci_param_untyped::get_write_generation() const
+{
+    return m_write_generation;
+}
+
 cci_originator cci_param_untyped::get_value_origin() const
 {
     return m_value_origin;
@@ -133,7 +157,9 @@ cci_param_untyped::register_##name##_callback(                                 \
 {                                                                              \
     fast_read=false;                                                           \
     fast_write=false;                                                          \
-    m_##name##_callbacks.vec.push_back(name##_callback_obj_t(cb, orig));       \
+    update_access_stamp();                                                     \
+    m_##name##_callbacks.vec.push_back(name##_callback_obj_t(cb, orig,         \
+        new cci_param_untyped_handle(*this, orig)));                           \
     return cb;                                                                 \
 }                                                                              \
                                                                                \
@@ -155,8 +181,9 @@ cci_param_untyped::unregister_##name##_callback(                               \
         it < m_##name##_callbacks.vec.end();                                   \
         it++)                                                                  \
     {                                                                          \
-        if(it->callback == cb && it->originator == orig) {                     \
-            m_##name##_callbacks.vec.erase(it);                                \
+        if(!it->removed && it->callback == cb && it->originator == orig) {     \
+            m_##name##_callbacks.erase(it);                                    \
+            update_access_stamp();                                             \
             return true;                                                       \
         }                                                                      \
     }                                                                          \
@@ -183,40 +210,50 @@ bool cci_param_untyped::unregister_all_callbacks(const cci_originator &orig)
     bool result = false;
     for (std::vector<pre_write_callback_obj_t>::iterator it =
             m_pre_write_callbacks.vec.begin();
-         it < m_pre_write_callbacks.vec.end(); it++)
+         it != m_pre_write_callbacks.vec.end();)
     {
-        if(it->originator == orig) {
-            m_pre_write_callbacks.vec.erase(it);
+        if(!it->removed && it->originator == orig) {
+            it = m_pre_write_callbacks.erase(it);
             result = true;
+        } else {
+            ++it;
         }
     }
     for(std::vector<post_write_callback_obj_t>::iterator it =
             m_post_write_callbacks.vec.begin();
-        it < m_post_write_callbacks.vec.end(); it++)
+        it != m_post_write_callbacks.vec.end();)
     {
-        if(it->originator == orig) {
-            m_post_write_callbacks.vec.erase(it);
+        if(!it->removed && it->originator == orig) {
+            it = m_post_write_callbacks.erase(it);
             result = true;
+        } else {
+            ++it;
         }
     }
     for(std::vector<pre_read_callback_obj_t>::iterator it =
             m_pre_read_callbacks.vec.begin();
-        it < m_pre_read_callbacks.vec.end(); it++)
+        it != m_pre_read_callbacks.vec.end();)
     {
-        if(it->originator == orig) {
-            m_pre_read_callbacks.vec.erase(it);
+        if(!it->removed && it->originator == orig) {
+            it = m_pre_read_callbacks.erase(it);
             result = true;
+        } else {
+            ++it;
         }
     }
     for(std::vector<post_read_callback_obj_t>::iterator it =
             m_post_read_callbacks.vec.begin();
-        it < m_post_read_callbacks.vec.end(); it++)
+        it != m_post_read_callbacks.vec.end();)
     {
-        if(it->originator == orig) {
-            m_post_read_callbacks.vec.erase(it);
+        if(!it->removed && it->originator == orig) {
+            it = m_post_read_callbacks.erase(it);
             result = true;
+        } else {
+            ++it;
         }
     }
+    if (result)
+        update_access_stamp();
     return result;
 }
 
@@ -238,6 +275,7 @@ bool cci_param_untyped::lock(const void* pwd)
         return false;
     } else {
         m_lock_pwd = pwd;
+        update_access_stamp();
         return true;
     }
 }
@@ -247,6 +285,7 @@ bool cci_param_untyped::unlock(const void* pwd)
     if (!pwd) pwd=this;
     if(pwd == m_lock_pwd) {
         m_lock_pwd = NULL;
+        update_access_stamp();
         return true;
     }
     return false;
@@ -269,23 +308,62 @@ cci_originator cci_param_untyped::get_originator() const
 
 void cci_param_untyped::add_param_handle(cci_param_untyped_handle* param_handle)
 {
-    m_param_handles.push_back(param_handle);
+    sc_assert( param_handle->m_prev_handle == NULL
+               && param_handle->m_next_handle == NULL );
+
+    param_handle->m_next_handle = m_param_handles;
+    if( m_param_handles )
+        m_param_handles->m_prev_handle = param_handle;
+    m_param_handles = param_handle;
 }
 
 void cci_param_untyped::remove_param_handle(
         cci_param_untyped_handle* param_handle)
 {
-    m_param_handles.erase(std::remove(m_param_handles.begin(),
-                                      m_param_handles.end(),
-                                      param_handle),
-                          m_param_handles.end());
+    cci_param_untyped_handle* prev = param_handle->m_prev_handle;
+    cci_param_untyped_handle* next = param_handle->m_next_handle;
+
+    if( prev )
+        prev->m_next_handle = next;
+    else if( m_param_handles == param_handle )
+        m_param_handles = next;
+    else
+        return; // not registered with this parameter
+
+    if( next )
+        next->m_prev_handle = prev;
+    param_handle->m_prev_handle = param_handle->m_next_handle = NULL;
+}
+
+void cci_param_untyped::set_observer(cci_param_observer_if* observer,
+                                     int events)
+{
+    m_observer = events ? observer : NULL;
+    m_observed_events = m_observer ? events : 0;
+    fast_read = false;
+    fast_write = false;
+    update_access_stamp();
+}
+
+bool cci_param_untyped::set_write_list(cci_impl::write_list* list)
+{
+    if( m_write_node.list )
+        m_write_node.list->unlink(m_write_node);
+    if( list )
+        list->link(m_write_node, *this, m_write_generation);
+    return true;
+}
+
+void cci_param_untyped::update_access_stamp()
+{
+    m_access_stamp = ++cci_impl::next_access_stamp;
 }
 
 void
 cci_param_untyped::invalidate_all_param_handles()
 {
-    while( !m_param_handles.empty() )
-        m_param_handles.front()->invalidate(); // removes itself from the list
+    while( m_param_handles )
+        m_param_handles->invalidate(); // removes itself from the list
 }
 
 CCI_CLOSE_NAMESPACE_
@@ -23,10 +23,12 @@
 #ifndef CCI_CFG_CCI_PARAM_UNTYPED_H_INCLUDED_
 #define CCI_CFG_CCI_PARAM_UNTYPED_H_INCLUDED_
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "cci/core/cci_core_types.h"
+#include "cci/core/cci_name_atom.h"
 #include "cci/core/cci_value.h"
 #include "cci/cfg/cci_param_if.h"
 #include "cci/cfg/cci_originator.h"
@@ -126,6 +128,26 @@ public:
      */
     virtual bool is_preset_value() const;
 
+    /// Write generation of the parameter's current value
+    /**
+     * Every successful write (including the application of a preset value
+     * and reset()) draws the next value of a process-wide, monotonically
+     * increasing write generation counter.  The value given at construction
+     * counts as a write as well.
+     *
+     * Polling consumers can detect changes by comparing the generation with
+     * a previously sampled current_write_generation(), without registering
+     * write callbacks (which disable the fast write path).
+     *
+     * @return Generation of the latest write to this parameter
+     * @see cci_broker_if::get_changed_param_handles
+     */
+    virtual uint64 get_write_generation() const;
+
+    /// Latest write generation drawn by any parameter
+    static uint64 current_write_generation()
+      { return last_write_generation; }
+
     ///@}
 
 
@@ -336,6 +358,8 @@ public:
     /// Add parameter handle
     /**
      * Add a parameter handle associated with this parameter.
+     * Handles are kept in an intrusive list, adding a handle takes
+     * constant time.
      *
      * @param param_handle Parameter handle to add.
      */
@@ -343,12 +367,18 @@ public:
 
     /// Remove parameter handle
     /**
-     * Remove a parameter handle associated with this parameter.
+     * Remove a parameter handle associated with this parameter
+     * in constant time.
      *
      * @param param_handle Parameter handle to remove.
      */
     void remove_param_handle(cci_param_untyped_handle* param_handle);
 
+    /// @copydoc cci_param_if::set_observer
+    void set_observer(cci_param_observer_if* observer, int events);
+
+    /// @copydoc cci_param_if::set_write_list
+    bool set_write_list(cci_impl::write_list* list);
 
 protected:
     /// @name Post callback handling implementation
@@ -547,8 +577,8 @@ protected:
     bool set_cci_value_allowed(cci_param_mutable_type mutability);
 
 protected:
-    /// Name
-    std::string m_name;
+    /// Name (interned)
+    cci_name_atom m_name;
 
     /// Description
     std::string m_description;
@@ -566,20 +596,71 @@ protected:
     mutable cci_originator m_value_origin;
 
     /// Callback object
+    /**
+     * The parameter handle passed to the callback is created once at
+     * registration and reused for every invocation.  The typed parameter
+     * resolves the callback into the handle it invokes (invoker) on the
+     * first dispatch, once the parameter is completely constructed.
+     */
     template<class T>
     struct callback_obj {
-        callback_obj(T cb, const cci_originator& orig):
-                callback(cb), originator(orig) {}
+        callback_obj(T cb, const cci_originator& orig,
+                     cci_param_untyped_handle* handle):
+                callback(cb), originator(orig), param_handle(handle),
+                resolved(false), removed(false) {}
         T callback;
+        T invoker;
         cci_originator originator;
+        std::shared_ptr<cci_param_untyped_handle> param_handle;
+        bool resolved;  ///< invoker is set
+        bool removed;   ///< unregistered during a dispatch
     };
 
     /// Callback object vector with tag to avoid nested callback
+    /**
+     * Callbacks unregistered during a dispatch (e.g. by themselves) are
+     * only marked as removed and erased once the dispatch is complete, so
+     * the dispatch may refer to the callback objects without copying them.
+     */
     template<class T>
     struct callback_obj_vector {
-      callback_obj_vector():oncall(false){};
-      std::vector<T> vec;
+      typedef typename std::vector<T>::iterator iterator;
+
+      callback_obj_vector():oncall(false),removed(false){};
+
+      /// Unregister a callback, returns the next one
+      iterator erase(iterator it)
+      {
+        if (!oncall)
+          return vec.erase(it);
+        it->removed = removed = true;
+        return ++it;
+      }
+
+      /// Marks the callbacks as being dispatched within its scope
+      class dispatch_scope
+      {
+      public:
+        explicit dispatch_scope(const callback_obj_vector& v) : m_v(v)
+          { m_v.oncall = true; }
+
+        ~dispatch_scope()
+        {
+          m_v.oncall = false;
+          if (!m_v.removed)
+            return;
+          for (iterator it = m_v.vec.begin(); it != m_v.vec.end();)
+            it = it->removed ? m_v.vec.erase(it) : it + 1;
+          m_v.removed = false;
+        }
+
+      private:
+        const callback_obj_vector& m_v;
+      };
+
+      mutable std::vector<T> vec;
       mutable bool oncall;
+      mutable bool removed;  ///< some callbacks are marked as removed
     };
 
     /// Pre write callbacks
@@ -609,15 +690,50 @@ protected:
     /// Originator of the parameter
     const cci_originator m_originator;
 
+    /// Observer (see set_observer)
+    cci_param_observer_if* m_observer;
+
+    /// Events reported to the observer (see cci_param_event_mask)
+    int m_observed_events;
+
 private:
     /// @copydoc cci_param_if::invalidate_all_param_handles
     virtual void invalidate_all_param_handles();
 
-    /// Parameter handles
-    std::vector<cci_param_untyped_handle*> m_param_handles;
+    /// Parameter handles (intrusive list, linked through the handles)
+    cci_param_untyped_handle* m_param_handles;
 
 protected:
     bool fast_read, fast_write;
+
+    /// Invalidate the pinned values of this parameter
+    /**
+     * Has to be called whenever a direct read of the value (see
+     * cci_param_typed::pin_raw_value) may become invalid, e.g. when
+     * callbacks are (un)registered or the value is relocated.
+     */
+    void update_access_stamp();
+
+    /// Access stamp (unique across all parameters)
+    uint64 m_access_stamp;
+
+    /// Record a successful write (see get_write_generation)
+    void update_write_generation()
+    {
+        m_write_generation = ++last_write_generation;
+        if (m_write_node.list)
+            m_write_node.list->touch(m_write_node, m_write_generation);
+    }
+
+    /// Generation of the latest write
+    uint64 m_write_generation;
+
+    /// Link in the write list of the broker (see set_write_list)
+    cci_impl::write_node m_write_node;
+
+private:
+    /// Latest write generation, shared by all parameters
+    static uint64 last_write_generation;
 };
 
 CCI_CLOSE_NAMESPACE_
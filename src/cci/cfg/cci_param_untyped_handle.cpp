@@ -34,6 +34,8 @@ cci_param_untyped_handle::
                           , const cci_originator & originator )
   : m_param(&param)
   , m_originator(originator)
+  , m_prev_handle(NULL)
+  , m_next_handle(NULL)
 {
     m_param->add_param_handle(this);
 }
@@ -42,6 +44,8 @@ cci_param_untyped_handle::
   cci_param_untyped_handle(const cci_originator & originator)
   : m_param(NULL)
   , m_originator(originator)
+  , m_prev_handle(NULL)
+  , m_next_handle(NULL)
 {}
 
 cci_param_untyped_handle::~cci_param_untyped_handle()
@@ -53,6 +57,8 @@ cci_param_untyped_handle::
   cci_param_untyped_handle(const cci_param_untyped_handle& param_handle)
     : m_param(param_handle.m_param)
     , m_originator(promote_originator(param_handle.m_originator))
+    , m_prev_handle(NULL)
+    , m_next_handle(NULL)
 {
     if(m_param) {
         m_param->add_param_handle(this);
@@ -64,6 +70,8 @@ cci_param_untyped_handle::
   cci_param_untyped_handle(cci_param_untyped_handle&& param_handle)
     : m_param(CCI_MOVE_(param_handle.m_param))
     , m_originator(promote_originator(param_handle.m_originator))
+    , m_prev_handle(NULL)
+    , m_next_handle(NULL)
 {
     if(m_param) {
         m_param->add_param_handle(this);
@@ -111,6 +119,18 @@ cci_param_untyped_handle::operator=(cci_param_untyped_handle&& param_handle)
 }
 #endif // CCI_HAS_CXX_RVALUE_REFS
 
+void cci_param_untyped_handle::set_view(cci_param_if* param)
+{
+    if (m_param == param)
+        return;
+
+    // unregister, in case the handle has been assigned in the meantime
+    if (m_param) {
+        m_param->remove_param_handle(this);
+    }
+    m_param = param;
+}
+
 std::string cci_param_untyped_handle::get_description() const
 {
     check_is_valid();
@@ -165,6 +185,12 @@ bool cci_param_untyped_handle::is_preset_value() const
     return m_param->is_preset_value();
 }
 
+uint64 cci_param_untyped_handle::get_write_generation() const
+{
+    check_is_valid();
+    return m_param->get_write_generation();
+}
+
 cci_originator
 cci_param_untyped_handle::get_value_origin() const
 {
@@ -268,6 +294,12 @@ const void* cci_param_untyped_handle::get_raw_default_value() const
     return m_param->get_raw_default_value();
 }
 
+const void* cci_param_untyped_handle::pin_raw_value(const uint64*& stamp) const
+{
+    check_is_valid();
+    return m_param ? m_param->pin_raw_value(stamp) : NULL;
+}
+
 void cci_param_untyped_handle::set_raw_value(const void* vp)
 {
     set_raw_value(vp, NULL);
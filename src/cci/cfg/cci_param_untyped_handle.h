@@ -123,6 +123,9 @@ public:
     /// @copydoc cci_param_if::is_preset_value
     bool is_preset_value() const;
 
+    /// @copydoc cci_param_if::get_write_generation
+    uint64 get_write_generation() const;
+
     ///@}
 
     ///@name Originator queries
@@ -253,6 +256,12 @@ protected:
     /// @copydoc cci_param_typed::get_raw_default_value
     const void* get_raw_default_value() const;
 
+    /// @copydoc cci_param_typed::pin_raw_value
+    const void* pin_raw_value(const uint64*& stamp) const;
+
+    /// Referenced parameter (NULL, if the handle is invalid)
+    const cci_param_if* get_param() const { return m_param; }
+
     /// @copydoc cci_param_typed::set_raw_value(const void*)
     void set_raw_value(const void* vp);
 
@@ -270,9 +279,26 @@ protected:
     inline const cci_originator promote_originator(const cci_originator &gifted_originator);
 
 private:
+    friend class cci_param_handle_sequence;
+    friend class cci_param_untyped;
+    friend class cci_param_view;
+    friend class cci_param_write_batch;
+
+    /// Point an unregistered handle to another parameter
+    /**
+     * The handle is not added to the handle list of the parameter, i.e. it
+     * is not invalidated when the parameter is destroyed (see
+     * cci_param_handle_sequence).  Copies of the handle are registered.
+     */
+    void set_view(cci_param_if* param);
+
     cci_param_if*  m_param;
     cci_originator m_originator;
 
+    /// Links of the intrusive handle list of a cci_param_untyped
+    cci_param_untyped_handle* m_prev_handle;
+    cci_param_untyped_handle* m_next_handle;
+
     /// Check handled parameter is valid
     /**
      * In case the handled parameter is no more valid, it will report an error.
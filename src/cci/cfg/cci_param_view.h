@@ -0,0 +1,113 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+#ifndef CCI_CFG_CCI_PARAM_VIEW_H_INCLUDED_
+#define CCI_CFG_CCI_PARAM_VIEW_H_INCLUDED_
+
+#include "cci/cfg/cci_originator.h"
+#include "cci/cfg/cci_param_if.h"
+#include "cci/cfg/cci_param_untyped_handle.h"
+
+CCI_OPEN_NAMESPACE_
+
+/// Non-owning view of a parameter
+/**
+ * Lightweight alternative to a cci_param_untyped_handle, passed to the
+ * visitor of cci_broker_if::for_each_param.  Creating a view neither
+ * allocates nor registers with the parameter.  Therefore, a view is only
+ * valid during the visitor invocation; use create_param_handle() to keep
+ * access to the parameter.
+ *
+ * Accesses through the view are performed on behalf of the originator
+ * passed to for_each_param.
+ */
+class cci_param_view
+{
+public:
+    /// Constructs a view of a parameter
+    cci_param_view(cci_param_if& param, const cci_originator& originator)
+      : m_param(&param), m_originator(&originator) {}
+
+    /// Constructs a view of the parameter referenced by a (valid) handle
+    explicit cci_param_view(const cci_param_untyped_handle& handle)
+      : m_param(handle.m_param), m_originator(&handle.m_originator) {}
+
+    /// @copydoc cci_param_if::name
+    const char* name() const { return m_param->name(); }
+
+    /// @copydoc cci_param_if::get_description
+    std::string get_description() const
+      { return m_param->get_description(); }
+
+    /// @copydoc cci_param_if::get_metadata
+    cci_value_map get_metadata() const { return m_param->get_metadata(); }
+
+    /// @copydoc cci_param_if::get_type_info
+    const std::type_info& get_type_info() const
+      { return m_param->get_type_info(); }
+
+    /// @copydoc cci_param_if::get_data_category
+    cci_param_data_category get_data_category() const
+      { return m_param->get_data_category(); }
+
+    /// @copydoc cci_param_if::get_mutable_type
+    cci_param_mutable_type get_mutable_type() const
+      { return m_param->get_mutable_type(); }
+
+    /// Get the current value (triggers the read callbacks)
+    cci_value get_cci_value() const
+      { return m_param->get_cci_value(*m_originator); }
+
+    /// @copydoc cci_param_if::get_default_cci_value
+    cci_value get_default_cci_value() const
+      { return m_param->get_default_cci_value(); }
+
+    /// @copydoc cci_param_if::is_default_value
+    bool is_default_value() const { return m_param->is_default_value(); }
+
+    /// @copydoc cci_param_if::is_preset_value
+    bool is_preset_value() const { return m_param->is_preset_value(); }
+
+    /// @copydoc cci_param_if::get_write_generation
+    uint64 get_write_generation() const
+      { return m_param->get_write_generation(); }
+
+    /// @copydoc cci_param_if::is_locked
+    bool is_locked() const { return m_param->is_locked(); }
+
+    /// @copydoc cci_param_if::get_originator
+    cci_originator get_originator() const
+      { return m_param->get_originator(); }
+
+    /// @copydoc cci_param_if::get_value_origin
+    cci_originator get_value_origin() const
+      { return m_param->get_value_origin(); }
+
+    /// Create a (registered) handle to the viewed parameter
+    cci_param_untyped_handle create_param_handle() const
+      { return m_param->create_param_handle(*m_originator); }
+
+private:
+    cci_param_if*         m_param;
+    const cci_originator* m_originator;
+};
+
+CCI_CLOSE_NAMESPACE_
+
+#endif // CCI_CFG_CCI_PARAM_VIEW_H_INCLUDED_
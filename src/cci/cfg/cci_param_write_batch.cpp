@@ -0,0 +1,146 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+#include "cci/cfg/cci_param_write_batch.h"
+#include "cci/cfg/cci_param_if.h"
+#include "cci/cfg/cci_report_handler.h"
+
+#include <memory>
+
+CCI_OPEN_NAMESPACE_
+
+///@cond CCI_HIDDEN_FROM_DOXYGEN
+namespace cci_impl {
+/// Staged writes of a batch commit, released on scope exit
+class staged_writes
+{
+public:
+    explicit staged_writes(std::size_t count)
+      : m_applied() { m_writes.reserve(count); }
+
+    ~staged_writes()
+    {
+        // roll back a partially applied batch (an apply threw)
+        while (m_applied)
+            m_writes[--m_applied]->rollback();
+    }
+
+    void push_back(staged_write_if* w)
+      { m_writes.push_back(std::unique_ptr<staged_write_if>(w)); }
+
+    void apply()
+    {
+        for (; m_applied < m_writes.size(); ++m_applied)
+            m_writes[m_applied]->apply();
+    }
+
+    void notify()
+    {
+        m_applied = 0; // applied, no roll back anymore
+        for (std::size_t i = 0; i < m_writes.size(); ++i)
+            m_writes[i]->notify();
+    }
+
+private:
+    std::vector<std::unique_ptr<staged_write_if> > m_writes;
+    std::size_t m_applied;
+};
+} // namespace cci_impl
+///@endcond
+
+cci_param_write_batch::cci_param_write_batch(const cci_broker_handle& broker)
+  : m_broker(broker)
+{}
+
+void cci_param_write_batch::set_cci_value(const std::string& parname,
+                                          const cci_value& value,
+                                          const void* pwd)
+{
+    cci_param_untyped_handle handle = m_broker.get_param_handle(parname);
+    if (!handle.is_valid()) {
+        std::string msg = "Parameter (" + parname + ") not found.";
+        cci_report_handler::set_param_failed(msg.c_str(), __FILE__, __LINE__);
+        return;
+    }
+    stage(handle, value, pwd);
+}
+
+void cci_param_write_batch::set_cci_value(
+        const cci_param_untyped_handle& param, const cci_value& value,
+        const void* pwd)
+{
+    param.check_is_valid();
+    stage(cci_param_untyped_handle(*param.m_param, get_originator()),
+          value, pwd);
+}
+
+void cci_param_write_batch::stage(const cci_param_untyped_handle& handle,
+                                  const cci_value& value, const void* pwd)
+{
+    std::map<const cci_param_if*, std::size_t>::iterator it =
+        m_index.find(handle.m_param);
+    // the staged handle is invalidated, if its parameter has been destroyed
+    // (and the address may have been reused by a new parameter)
+    if (it != m_index.end()
+        && m_writes[it->second].handle.m_param == handle.m_param) {
+        // coalesce, the last staged value wins
+        m_writes[it->second].value = value;
+        m_writes[it->second].pwd = pwd;
+        return;
+    }
+    m_index[handle.m_param] = m_writes.size();
+    m_writes.push_back(write(handle, value, pwd));
+}
+
+void cci_param_write_batch::clear()
+{
+    m_writes.clear();
+    m_index.clear();
+}
+
+bool cci_param_write_batch::commit()
+{
+    std::vector<write> writes;
+    writes.swap(m_writes);
+    m_index.clear();
+
+    // check all writes, before modifying any parameter
+    cci_impl::staged_writes staged(writes.size());
+    const cci_originator originator = get_originator();
+    for (std::size_t i = 0; i < writes.size(); ++i) {
+        if (!writes[i].handle.is_valid()) {
+            cci_report_handler::set_param_failed(
+                "Parameter destroyed before the batch commit.",
+                __FILE__, __LINE__);
+            return false;
+        }
+        cci_impl::staged_write_if* w = writes[i].handle.m_param->
+            stage_cci_value(writes[i].value, writes[i].pwd, originator);
+        if (!w)
+            return false;
+        staged.push_back(w);
+    }
+
+    staged.apply();
+    // a single post write notification per parameter
+    staged.notify();
+    return true;
+}
+
+CCI_CLOSE_NAMESPACE_
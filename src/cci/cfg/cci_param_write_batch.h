@@ -0,0 +1,141 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+
+#ifndef CCI_CFG_CCI_PARAM_WRITE_BATCH_H_INCLUDED_
+#define CCI_CFG_CCI_PARAM_WRITE_BATCH_H_INCLUDED_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "cci/core/cci_value.h"
+#include "cci/cfg/cci_broker_handle.h"
+#include "cci/cfg/cci_originator.h"
+#include "cci/cfg/cci_param_untyped_handle.h"
+
+CCI_OPEN_NAMESPACE_
+
+// forward declaration
+class cci_param_if;
+
+/// Batch of parameter writes, committed as a whole
+/**
+ * Stages writes to several parameters and applies them atomically:
+ * commit() first runs the checks of all writes (mutability, lock state,
+ * value conversion and pre write callbacks).  Only if all checks pass,
+ * all values are written, followed by a single post write notification
+ * per parameter.  Thereby, post write callbacks observe the final state
+ * of the whole batch.  If a check fails, no parameter is modified.
+ *
+ * Staging the same parameter more than once keeps the last value.
+ * The writes are checked and notified in the order the parameters have
+ * been staged first.
+ *
+ * @code
+ * cci_param_write_batch batch = broker.create_write_batch();
+ * batch.set_cci_value("top.cpu.freq", cci_value(1000000));
+ * batch.set_cci_value("top.cpu.divider", cci_value(4));
+ * if (!batch.commit())
+ *   ...; // nothing has been written
+ * @endcode
+ *
+ * @note Pre write callbacks are invoked on the unmodified parameters,
+ *       i.e. they cannot observe the other values of the batch.  They are
+ *       not notified, if the batch is abandoned after they have accepted
+ *       a write (i.e. a later check fails, or applying a value throws and
+ *       the batch is rolled back).
+ * @see cci_broker_handle::create_write_batch
+ */
+class cci_param_write_batch
+{
+public:
+    /// Constructs an empty batch, writing on behalf of the broker's originator
+    explicit cci_param_write_batch(const cci_broker_handle& broker);
+
+    /// Stage a write to a parameter (by name)
+    /**
+     * @param parname Full hierarchical parameter name
+     * @param value   New value
+     * @param pwd     Password, if the parameter is locked
+     *
+     * @exception cci_report_handler::set_param_failed
+     *            in case the parameter does not exist
+     */
+    void set_cci_value(const std::string& parname, const cci_value& value,
+                       const void* pwd = NULL);
+
+    /// Stage a write to a parameter (by handle)
+    /**
+     * @param param   Parameter handle (the batch's originator is used)
+     * @param value   New value
+     * @param pwd     Password, if the parameter is locked
+     */
+    void set_cci_value(const cci_param_untyped_handle& param,
+                       const cci_value& value, const void* pwd = NULL);
+
+    /// Number of staged writes
+    std::size_t size() const { return m_writes.size(); }
+
+    /// Returns true, if no writes are staged
+    bool empty() const { return m_writes.empty(); }
+
+    /// Drop all staged writes
+    void clear();
+
+    /// Check and apply all staged writes
+    /**
+     * The batch is empty afterwards, regardless of the result.
+     *
+     * @return true, if all writes have been applied; false, if a check
+     *         failed and no parameter has been modified
+     * @exception cci_report_handler::set_param_failed
+     *            (depending on the report configuration) in case of a
+     *            failed check
+     */
+    bool commit();
+
+    /// Originator of the writes
+    cci_originator get_originator() const { return m_broker.get_originator(); }
+
+private:
+    struct write
+    {
+        write(const cci_param_untyped_handle& h, const cci_value& v,
+              const void* p)
+          : handle(h), value(v), pwd(p) {}
+
+        cci_param_untyped_handle handle;
+        cci_value                value;
+        const void*              pwd;
+    };
+
+    void stage(const cci_param_untyped_handle& handle, const cci_value& value,
+               const void* pwd);
+
+    cci_broker_handle  m_broker;
+    std::vector<write> m_writes;
+    /// position of the staged write of each parameter
+    std::map<const cci_param_if*, std::size_t> m_index;
+};
+
+CCI_CLOSE_NAMESPACE_
+
+#endif // CCI_CFG_CCI_PARAM_WRITE_BATCH_H_INCLUDED_
@@ -137,10 +137,10 @@ private:
 
         void decrement() {
             if(m_fr) {
-                if(m_current != m_fr->m_begin) {
+                if(m_current != m_fr->m_begin.m_current) {
                     --m_current;
                 }
-                while((m_current != m_fr->m_begin)
+                while((m_current != m_fr->m_begin.m_current)
                       && (!m_fr->m_pred(*(m_current)))) {
                     --m_current;
                 }
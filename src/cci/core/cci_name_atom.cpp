@@ -0,0 +1,184 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+****************************************************************************/
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "cci/core/cci_name_atom.h"
+
+CCI_OPEN_NAMESPACE_
+
+///@cond CCI_HIDDEN_FROM_DOXYGEN
+namespace cci_impl {
+
+/// Process-wide table of interned names
+/**
+ * The names are stored in large character blocks, indexed by an
+ * open-addressing hash table.  Names are never released.
+ */
+class name_intern_table
+{
+  typedef cci_name_atom::rep rep;
+
+  enum { block_size = 64 * 1024, initial_slots = 1024 };
+
+public:
+  static name_intern_table& instance()
+  {
+    // intentionally leaked, interned names may be used during static
+    // destruction
+    static name_intern_table* table = new name_intern_table;
+    return *table;
+  }
+
+  const rep* lookup(const char* name, std::size_t len, std::size_t h) const
+    { return m_slots[slot_of(name, len, h)]; }
+
+  const rep* intern(const char* name, std::size_t len, std::size_t h)
+  {
+    std::size_t i = slot_of(name, len, h);
+    if (m_slots[i])
+      return m_slots[i];
+
+    // keep the load factor below 3/4
+    if ((m_count + 1) * 4 > m_slots.size() * 3) {
+      grow();
+      i = slot_of(name, len, h);
+    }
+
+    rep* r = static_cast<rep*>(allocate(offsetof(rep, str) + len + 1));
+    r->id     = ++m_count;
+    r->hash   = h;
+    r->length = len;
+    std::memcpy(r->str, name, len);
+    r->str[len] = '\0';
+    m_slots[i] = r;
+    return r;
+  }
+
+  std::size_t size() const { return m_count; }
+
+private:
+  name_intern_table()
+    : m_slots(initial_slots), m_count(), m_free(NULL), m_left() {}
+
+  std::size_t slot_of(const char* name, std::size_t len, std::size_t h) const
+  {
+    const std::size_t mask = m_slots.size() - 1;
+    std::size_t i = h & mask;
+    while (const rep* r = m_slots[i]) {
+      if (r->hash == h && r->length == len
+          && (r->str == name || std::memcmp(r->str, name, len) == 0))
+        break;
+      i = (i + 1) & mask;
+    }
+    return i;
+  }
+
+  void grow()
+  {
+    std::vector<const rep*> slots(m_slots.size() * 2);
+    const std::size_t mask = slots.size() - 1;
+    for (std::size_t k = 0; k < m_slots.size(); ++k) {
+      if (!m_slots[k])
+        continue;
+      std::size_t i = m_slots[k]->hash & mask;
+      while (slots[i])
+        i = (i + 1) & mask;
+      slots[i] = m_slots[k];
+    }
+    m_slots.swap(slots);
+  }
+
+  void* allocate(std::size_t size)
+  {
+    const std::size_t align = sizeof(std::size_t);
+    size = (size + align - 1) & ~(align - 1);
+
+    if (size > block_size / 4) // large names get a dedicated block
+      return ::operator new(size);
+    if (size > m_left) {
+      m_free = static_cast<char*>(::operator new(block_size));
+      m_left = block_size;
+    }
+    void* p = m_free;
+    m_free += size;
+    m_left -= size;
+    return p;
+  }
+
+  std::vector<const rep*> m_slots;
+  std::size_t             m_count;
+  char*                   m_free;
+  std::size_t             m_left;
+};
+
+} // namespace cci_impl
+///@endcond
+
+std::size_t cci_name_atom::hash(const char* name, std::size_t length)
+{
+  // FNV-1a
+  std::size_t h = static_cast<std::size_t>(2166136261u);
+  for (std::size_t i = 0; i < length; ++i) {
+    h ^= static_cast<unsigned char>(name[i]);
+    h *= static_cast<std::size_t>(16777619u);
+  }
+  return h;
+}
+
+cci_name_atom::cci_name_atom(const char* name)
+  : m_rep(NULL)
+{
+  if (name) {
+    const std::size_t len = std::strlen(name);
+    m_rep = cci_impl::name_intern_table::instance()
+              .intern(name, len, hash(name, len));
+  }
+}
+
+cci_name_atom::cci_name_atom(const std::string& name)
+  : m_rep(cci_impl::name_intern_table::instance()
+            .intern(name.data(), name.size(), hash(name.data(), name.size())))
+{}
+
+cci_name_atom cci_name_atom::lookup(const char* name)
+{
+  if (!name)
+    return cci_name_atom();
+  const std::size_t len = std::strlen(name);
+  return cci_name_atom(cci_impl::name_intern_table::instance()
+                         .lookup(name, len, hash(name, len)));
+}
+
+cci_name_atom cci_name_atom::lookup(const std::string& name)
+{
+  return cci_name_atom(cci_impl::name_intern_table::instance()
+                         .lookup(name.data(), name.size(),
+                                 hash(name.data(), name.size())));
+}
+
+std::size_t cci_name_atom::interned_count()
+{
+  return cci_impl::name_intern_table::instance().size();
+}
+
+CCI_CLOSE_NAMESPACE_
@@ -0,0 +1,133 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+#ifndef CCI_CORE_CCI_NAME_ATOM_H_INCLUDED_
+#define CCI_CORE_CCI_NAME_ATOM_H_INCLUDED_
+
+#include <cstddef>
+#include <string>
+
+#include "cci/core/cci_cmnhdr.h"
+
+CCI_OPEN_NAMESPACE_
+
+/// Interned CCI element name
+/**
+ * A name atom is a lightweight handle to a process-wide, unique copy of a
+ * (hierarchical) name.  Interning the same string twice returns the same
+ * atom, so that atoms can be compared by identity instead of comparing the
+ * underlying strings.  Each atom carries a unique (non-zero) id and a
+ * precomputed hash value.
+ *
+ * Interned names are never released; the returned string pointers stay
+ * valid until the end of the simulation.  The table therefore grows with
+ * every distinct name ever interned: the names of parameters (including
+ * the generated names of destroyed ones), the names of preset values and
+ * the names passed to cci_gen_unique_name().  Looking up a name (see
+ * lookup()) does not intern it.  Use interned_count() to monitor the
+ * growth, e.g. when parameters with unique names are created repeatedly.
+ *
+ * A default constructed atom is a null atom, which does not refer to any
+ * name.
+ *
+ * @note The intern table is not thread-safe.  Interning a name may grow
+ *       and rehash the table, so neither interning nor lookups must run
+ *       concurrently with interning.  Like the rest of the CCI library,
+ *       atoms are expected to be created from the SystemC thread only.
+ */
+class cci_name_atom
+{
+public:
+  /// Constructs a null atom
+  cci_name_atom() : m_rep(NULL) {}
+
+  /// Interns the given name (NULL yields a null atom)
+  cci_name_atom(const char* name);
+
+  /// Interns the given name
+  cci_name_atom(const std::string& name);
+
+  /// Looks up an already interned name
+  /**
+   * Does not intern the given name.
+   *
+   * @param name name to look up
+   *
+   * @return the atom of the name, if it has been interned before,
+   *         a null atom otherwise.
+   */
+  static cci_name_atom lookup(const char* name);
+  /// @copydoc lookup(const char*)
+  static cci_name_atom lookup(const std::string& name);
+
+  /// Number of interned names
+  static std::size_t interned_count();
+
+  /// Returns the interned name (or NULL for a null atom)
+  const char* c_str() const
+    { return m_rep ? m_rep->str : NULL; }
+
+  /// Returns the length of the interned name
+  std::size_t length() const
+    { return m_rep ? m_rep->length : 0; }
+
+  /// Returns the unique id of this atom (0 for a null atom)
+  std::size_t id() const
+    { return m_rep ? m_rep->id : 0; }
+
+  /// Returns the hash value of the interned name
+  std::size_t hash() const
+    { return m_rep ? m_rep->hash : 0; }
+
+  /// Returns true, if this is a null atom
+  bool is_null() const
+    { return m_rep == NULL; }
+
+  /// Identity comparison
+  bool operator==(const cci_name_atom& that) const
+    { return m_rep == that.m_rep; }
+  bool operator!=(const cci_name_atom& that) const
+    { return m_rep != that.m_rep; }
+
+  /// Orders atoms by their id (i.e. in order of interning)
+  bool operator<(const cci_name_atom& that) const
+    { return id() < that.id(); }
+
+  /// Computes the hash value of a name
+  static std::size_t hash(const char* name, std::size_t length);
+
+  ///@cond CCI_HIDDEN_FROM_DOXYGEN
+  struct rep
+  {
+    std::size_t id;
+    std::size_t hash;
+    std::size_t length;
+    char        str[1];
+  };
+  ///@endcond
+
+private:
+  explicit cci_name_atom(const rep* r) : m_rep(r) {}
+
+  const rep* m_rep;
+};
+
+CCI_CLOSE_NAMESPACE_
+
+#endif // CCI_CORE_CCI_NAME_ATOM_H_INCLUDED_
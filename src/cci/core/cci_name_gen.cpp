@@ -22,6 +22,7 @@
 #include <map>
 
 #include "cci/core/cci_name_gen.h"
+#include "cci/core/cci_name_atom.h"
 #include "cci/cfg/cci_report_handler.h"
 
 CCI_OPEN_NAMESPACE_
@@ -32,12 +33,14 @@ enum cci_name_state {
     cci_name_used
 };
 
-std::map<std::string, std::pair<int, cci_name_state> >&
-cci_get_cci_unique_names()
+typedef std::map<cci_name_atom, std::pair<int, cci_name_state> >
+        cci_unique_names_map;
+
+cci_unique_names_map& cci_get_cci_unique_names()
 {
     /// CCI unique names map used when SystemC < 2.3.2
-    static std::map<std::string, std::pair<int, cci_name_state> >
-            cci_unique_names;
+    /// (keyed by interned names, shared with the parameters and brokers)
+    static cci_unique_names_map cci_unique_names;
     return cci_unique_names;
 }
 #endif
@@ -65,11 +68,10 @@ const char* cci_gen_unique_name(const char *name)
     return sc_core::sc_get_hierarchical_name(name);
 #else
     bool systemc_conflict = false;
-    std::pair<std::map<std::string,
-            std::pair<int, cci_name_state> >::iterator, bool> ret;
-    ret = cci_get_cci_unique_names().insert(std::pair<std::string,
-                                  std::pair<int, cci_name_state> >(name,
-                    std::make_pair(0, cci_name_used)));
+    std::pair<cci_unique_names_map::iterator, bool> ret;
+    ret = cci_get_cci_unique_names().insert(
+            std::make_pair(cci_name_atom(name),
+                           std::make_pair(0, cci_name_used)));
     if(sc_core::sc_find_object(name)) {
         systemc_conflict = true;
     }
@@ -81,9 +83,9 @@ const char* cci_gen_unique_name(const char *name)
         if (systemc_conflict) {
             CCI_NAME_CONFLICT_WITH_SYSTEMC_WARNING_(name, new_name.str());
         }
-        return cci_get_cci_unique_names().find(new_name.str())->first.c_str();
+        return cci_name_atom::lookup(new_name.str()).c_str();
     }
-    return cci_get_cci_unique_names().find(name)->first.c_str();
+    return ret.first->first.c_str();
 #endif
 }
 
@@ -92,8 +94,8 @@ const char* cci_get_name(const char *name)
 #if CCI_SYSTEMC_VERSION_CODE_ >= CCI_VERSION_HELPER_(2,3,2)
     return sc_core::sc_get_hierarchical_name(name);
 #else
-    std::map<std::string, std::pair<int, cci_name_state> >::iterator
-            it = cci_get_cci_unique_names().find(name);
+    cci_unique_names_map::iterator
+            it = cci_get_cci_unique_names().find(cci_name_atom::lookup(name));
     if (it != cci_get_cci_unique_names().end()) {
         return it->first.c_str();
     } else {
@@ -107,8 +109,8 @@ bool cci_unregister_name(const char *name)
 #if CCI_SYSTEMC_VERSION_CODE_ >= CCI_VERSION_HELPER_(2,3,2)
     return sc_core::sc_unregister_hierarchical_name(name);
 #else
-    std::map<std::string, std::pair<int, cci_name_state> >::iterator
-            it = cci_get_cci_unique_names().find(name);
+    cci_unique_names_map::iterator
+            it = cci_get_cci_unique_names().find(cci_name_atom::lookup(name));
     if (it != cci_get_cci_unique_names().end()) {
         it->second.second = cci_name_free;
         return true;
@@ -34,7 +34,11 @@
 #include "cci/cfg/cci_report_handler.h"
 
 #include <algorithm> // std::swap
+#include <atomic>
+#include <mutex>
 #include <sstream> //std::stringstream
+#include <type_traits> // std::aligned_storage
+#include <vector>
 
 namespace rapidjson = RAPIDJSON_NAMESPACE;
 
@@ -57,37 +61,210 @@ static allocator_type json_allocator;
 // wrapper implementation is simply a RapidJSON value
 typedef json_value impl_type;
 
+// arena trees take their nodes from a memory pool, which never frees
+// single nodes (the pool is released as a whole)
+typedef rapidjson::MemoryPoolAllocator<allocator_type>                arena_allocator_type;
+typedef rapidjson::GenericValue<encoding_type, arena_allocator_type>  arena_value;
+typedef rapidjson::GenericDocument<encoding_type, arena_allocator_type> arena_document;
+
+// arena trees are read through the regular value interface, which does
+// not depend on the allocator type
+static_assert( sizeof(arena_value) == sizeof(json_value)
+             , "arena values must share the layout of regular values" );
+
 // helper to convert to wrapper implementation
 static inline impl_type* impl_cast(void* p)
   { return static_cast<impl_type*>(p); }
 
-// simple memory pool for impl wrapper objects (non-deallocating)
-//  - this pool handles the "top-level" objects only
+// per-thread memory pool for impl wrapper objects
+//  - this pool handles the "top-level" list and map objects only
+//    (cci_value objects keep their representation inline)
 //  - RapidJSON allocation is still done via a plain malloc/free allocator
-struct impl_pool
+//  - objects released on another thread are handed back to the owning
+//    pool through a lock-free stack
+//  - pools are never destroyed, the pools of finished threads are adopted
+//    by new threads
+class impl_pool
 {
+  struct slot
+  {
+    std::aligned_storage< sizeof(impl_type)
+                        , std::alignment_of<impl_type>::value >::type storage;
+    impl_pool* owner;
+    slot*      next;
+  };
+
+public:
   static impl_type* allocate()
   {
-    impl_type* ret = free_list_;
-    if (free_list_ != NULL) {
-      free_list_ = *reinterpret_cast<impl_type**>(free_list_);
-      new (ret) impl_type(); // initialize JSON object (placement new)
-    } else {
-      ret = new impl_type();
+    impl_pool* pool = local();
+    slot* s = pool ? pool->pop() : NULL;
+    if( !s ) {
+      s = new slot;
+      s->owner = pool;
+    }
+    if( pool ) pool->track_allocate();
+
+    try {
+      return new (&s->storage) impl_type(); // initialize JSON object
+    } catch( ... ) {
+      if( pool ) pool->release( s );
+      else delete s;
+      throw;
     }
-    return ret;
   }
 
-  static void deallocate(impl_type* elem) {
+  static void deallocate(impl_type* elem)
+  {
     if (elem == NULL) return; // delete NULL is no-op
     elem->~impl_type();       // release internal memory (not pooled)
-     *reinterpret_cast<impl_type**>(elem) = free_list_;
-    free_list_ = elem;
+
+    slot* s = reinterpret_cast<slot*>(elem);
+    if( !s->owner )
+      delete s;
+    else if( s->owner == local() )
+      s->owner->release( s );
+    else
+      s->owner->release_remote( s );
   }
+
+  static cci_value_pool_stats statistics()
+  {
+    cci_value_pool_stats stats = cci_value_pool_stats();
+    if( impl_pool* pool = local() ) {
+      pool->drain();
+      stats.live   = pool->live();
+      stats.pooled = pool->pooled_;
+      stats.peak   = pool->peak_;
+    }
+    return stats;
+  }
+
+  static std::atomic<std::size_t> limit;
+
 private:
-  static impl_type* free_list_;
+  impl_pool()
+    : free_list_(NULL), remote_list_(NULL), remote_freed_(0)
+    , allocated_(), freed_(), pooled_(), peak_() {}
+
+  // pool of the current thread (NULL during thread exit)
+  static impl_pool* local()
+  {
+    struct guard
+    {
+      explicit guard( bool& done ) : done_(done), pool_(adopt()) {}
+      ~guard() { done_ = true; orphan( pool_ ); }
+      bool&      done_;
+      impl_pool* pool_;
+    };
+    static thread_local bool done = false;
+    if( done ) return NULL;
+    static thread_local guard g( done );
+    return g.pool_;
+  }
+
+  static std::mutex& orphans_mutex()
+  {
+    static std::mutex* m = new std::mutex; // intentionally leaked
+    return *m;
+  }
+
+  static std::vector<impl_pool*>& orphans()
+  {
+    static std::vector<impl_pool*>* v = new std::vector<impl_pool*>;
+    return *v;
+  }
+
+  static impl_pool* adopt()
+  {
+    std::lock_guard<std::mutex> lock( orphans_mutex() );
+    if( orphans().empty() )
+      return new impl_pool;
+    impl_pool* pool = orphans().back();
+    orphans().pop_back();
+    return pool;
+  }
+
+  static void orphan( impl_pool* pool )
+  {
+    std::lock_guard<std::mutex> lock( orphans_mutex() );
+    orphans().push_back( pool );
+  }
+
+  std::size_t live() const
+  {
+    return allocated_ - freed_
+         - remote_freed_.load( std::memory_order_relaxed );
+  }
+
+  void track_allocate()
+  {
+    ++allocated_;
+    const std::size_t n = live();
+    if( n > peak_ ) peak_ = n;
+  }
+
+  slot* pop()
+  {
+    if( !free_list_ ) drain();
+    slot* s = free_list_;
+    if( s ) {
+      free_list_ = s->next;
+      --pooled_;
+    }
+    return s;
+  }
+
+  void push( slot* s )
+  {
+    if( pooled_ >= limit.load( std::memory_order_relaxed ) ) {
+      delete s;
+      return;
+    }
+    s->next = free_list_;
+    free_list_ = s;
+    ++pooled_;
+  }
+
+  // release an object of this pool on the owning thread
+  void release( slot* s )
+  {
+    ++freed_;
+    push( s );
+  }
+
+  // release an object of this pool on another thread
+  void release_remote( slot* s )
+  {
+    remote_freed_.fetch_add( 1, std::memory_order_relaxed );
+    s->next = remote_list_.load( std::memory_order_relaxed );
+    while( !remote_list_.compare_exchange_weak( s->next, s
+                                              , std::memory_order_release
+                                              , std::memory_order_relaxed ) )
+    {}
+  }
+
+  // take over the objects released by other threads
+  void drain()
+  {
+    slot* s = remote_list_.exchange( NULL, std::memory_order_acquire );
+    while( s ) {
+      slot* next = s->next;
+      push( s );
+      s = next;
+    }
+  }
+
+  slot*                    free_list_;
+  std::atomic<slot*>       remote_list_;
+  std::atomic<std::size_t> remote_freed_;
+  // owner-only counters
+  std::size_t              allocated_;
+  std::size_t              freed_;
+  std::size_t              pooled_;
+  std::size_t              peak_;
 };
-impl_type* impl_pool::free_list_;
+std::atomic<std::size_t> impl_pool::limit( 4096 );
 
 } // anonymous namespace
 
@@ -828,14 +1005,17 @@ cci_value_map_ref::erase(const_iterator first, const_iterator last)
 #define WRAPPER_DO_INIT_cci_value_map \
   (THIS)->SetObject()
 
-#define DEFINE_WRAPPER_(Kind)                          \
+#define DEFINE_WRAPPER_ASSIGN_(Kind)                   \
   Kind::this_type &                                    \
   Kind::operator=( const_reference that )              \
   {                                                    \
     WRAPPER_ASSIGN_PRECOND_( Kind );                   \
     reference::operator=( that );                      \
     return *this;                                      \
-  }                                                    \
+  }
+
+#define DEFINE_WRAPPER_(Kind)                          \
+  DEFINE_WRAPPER_ASSIGN_(Kind)                         \
                                                        \
   void                                                 \
   Kind::swap( this_type & that )                       \
@@ -859,18 +1039,50 @@ cci_value_map_ref::erase(const_iterator first, const_iterator last)
     impl_pool::deallocate(impl_cast(own_pimpl_));      \
   }
 
-DEFINE_WRAPPER_(cci_value)
+DEFINE_WRAPPER_ASSIGN_(cci_value)
 DEFINE_WRAPPER_(cci_value_list)
 DEFINE_WRAPPER_(cci_value_map)
 
+// cci_value keeps its representation inline (no pool allocation)
+
+void
+cci_value::swap( this_type & that )
+{
+  if( !own_pimpl_ && !that.own_pimpl_ )
+    return;
+  init();
+  that.init();
+  THIS->Swap( DEREF(that) );
+}
+
+cci_value::impl_type
+cci_value::do_init()
+{
+  static_assert( sizeof(json_value) <= sizeof(storage_type)
+               , "inline storage of cci_value too small" );
+  static_assert( std::alignment_of<json_value>::value
+                   <= std::alignment_of<storage_type>::value
+               , "inline storage of cci_value insufficiently aligned" );
+  sc_assert( !own_pimpl_ );
+  pimpl_ = own_pimpl_ = new (&storage_) json_value();
+  return THIS;
+}
+
+cci_value::~cci_value()
+{
+  if( own_pimpl_ )
+    impl_cast(own_pimpl_)->~json_value();
+}
+
 #ifdef CCI_HAS_CXX_RVALUE_REFS
 
 cci_value::cci_value( this_type && that )
-  : cci_value_ref(CCI_MOVE_(that.pimpl_))
-  , own_pimpl_(CCI_MOVE_(that.own_pimpl_))
+  : own_pimpl_()
 {
-  that.pimpl_ = NULL;
-  that.own_pimpl_ = NULL;
+  if( that.own_pimpl_ ) {
+    do_init();
+    *THIS = CCI_MOVE_(DEREF(that));
+  }
 }
 
 cci_value::cci_value( cci_value_list && that )
@@ -907,10 +1119,13 @@ cci_value_map::cci_value_map( this_type && that )
 
 cci_value& cci_value::operator=( this_type && that )
 {
-  if (own_pimpl_ == that.own_pimpl_) return *this;
-  impl_pool::deallocate(impl_cast(own_pimpl_));
-  pimpl_ = own_pimpl_ = that.own_pimpl_;
-  that.pimpl_ = that.own_pimpl_ = NULL;
+  if (this == &that) return *this;
+  if (!that.own_pimpl_) {
+    set_null();
+  } else {
+    init();
+    *THIS = CCI_MOVE_(DEREF(that));
+  }
   return *this;
 }
 
@@ -948,6 +1163,107 @@ cci_value_map& cci_value_map::operator=(this_type && that)
 
 #endif // CCI_HAS_CXX_RVALUE_REFS
 
+// ----------------------------------------------------------------------------
+// cci_value_pool
+
+cci_value_pool_stats
+cci_value_pool::statistics()
+{
+  return impl_pool::statistics();
+}
+
+std::size_t
+cci_value_pool::limit()
+{
+  return impl_pool::limit.load( std::memory_order_relaxed );
+}
+
+void
+cci_value_pool::set_limit( std::size_t max_pooled )
+{
+  impl_pool::limit.store( max_pooled, std::memory_order_relaxed );
+}
+
+// ----------------------------------------------------------------------------
+// cci_value_arena
+
+///@cond CCI_HIDDEN_FROM_DOXYGEN
+namespace /* anonymous */ {
+
+struct arena_impl
+{
+  explicit arena_impl( std::size_t chunk_size )
+    : allocator( chunk_size ), doc( &allocator ) {}
+
+  arena_allocator_type allocator; // initialized first, used by doc
+  arena_document       doc;
+};
+
+static inline arena_impl* arena_cast( void* p )
+  { return static_cast<arena_impl*>(p); }
+
+} // anonymous namespace
+///@endcond
+
+cci_value_arena::cci_value_arena( std::size_t chunk_size )
+  : pimpl_( new arena_impl(chunk_size) )
+{}
+
+cci_value_arena::~cci_value_arena()
+{
+  delete arena_cast(pimpl_);
+}
+
+cci_value_cref
+cci_value_arena::get() const
+{
+  arena_value& root = arena_cast(pimpl_)->doc;
+  return cci_value_cref( reinterpret_cast<impl_type*>(&root) );
+}
+
+cci_value_cref
+cci_value_arena::assign( cci_value_cref value )
+{
+  clear();
+  if( PIMPL(value) ) {
+    arena_impl* a = arena_cast(pimpl_);
+    a->doc.CopyFrom( DEREF(value), a->allocator );
+  }
+  return get();
+}
+
+cci_value_cref
+cci_value_arena::from_json( std::string const & json )
+{
+  clear();
+  try {
+    arena_cast(pimpl_)->doc.Parse( json.c_str() );
+  }
+  catch ( rapidjson::ParseException const & ex )
+  {
+    clear();
+    std::stringstream ss;
+      ss << "JSON parse error: " << ex.what()
+       << " (offset: " << ex.Offset() << ")";
+    get().report_error( ss.str().c_str(), __FILE__, __LINE__ );
+  }
+  return get();
+}
+
+void
+cci_value_arena::clear()
+{
+  arena_impl* a = arena_cast(pimpl_);
+  a->doc.SetNull();        // nodes are not freed one by one
+  a->allocator.Clear();
+}
+
+std::size_t
+cci_value_arena::capacity() const
+{
+  return arena_cast(pimpl_)->allocator.Capacity();
+}
+
 // ----------------------------------------------------------------------------
 // JSON (de)serialize
 
@@ -55,6 +55,7 @@ class cci_value_map_cref;
 class cci_value_map_ref;
 class cci_value_map_elem_ref;
 class cci_value_map_elem_cref;
+class cci_value_arena;
 
 template<typename T> struct cci_value_converter;
 template<typename T> struct cci_value_has_converter;
@@ -110,6 +111,7 @@ class cci_value_cref
   friend class cci_value_map_cref;
   friend class cci_value_map_ref;
   friend class cci_value_map_elem_cref;
+  friend class cci_value_arena;
   template<typename U> friend class cci_impl::value_iterator_impl;
   friend bool operator==( cci_value_cref const &, cci_value_cref const & );
   friend std::ostream& operator<<( std::ostream&, cci_value_cref const & );
@@ -1118,6 +1120,10 @@ cci_value_ref::get_map()
  * by dedicated reference objects (cci_value_cref, cci_value_ref, and their
  * specialized variants for strings, lists and maps), with or without constness.
  *
+ * The representation of a cci_value is stored inline.  Hence, scalar values
+ * and short strings do not require any dynamic memory allocation, only
+ * lists, maps and longer strings allocate their elements separately.
+ *
  * Users can add automatic conversions from/to cci_value objects by providing
  * an implementation (or specialisation) of the cci_value_converter class.
  * Corresponding specializations for the builtin types, the SystemC data types
@@ -1263,7 +1269,17 @@ private:
   impl_type init();
   impl_type do_init();
 
-  impl_type own_pimpl_;
+  /// inline storage of the value representation
+  union storage_type
+  {
+    void*  ptr_;
+    double dbl_;
+    uint64 u64_;
+    char   buf_[4 * sizeof(void*)];
+  };
+
+  impl_type    own_pimpl_;
+  storage_type storage_;
 };
 
 template<typename T>
@@ -1489,6 +1505,98 @@ cci_value_map::operator=( this_type const & that )
 
 // --------------------------------------------------------------------------
 
+/// statistics of the cci_value object pool of a thread
+struct cci_value_pool_stats
+{
+  std::size_t live;   ///< objects currently in use
+  std::size_t pooled; ///< released objects kept for reuse
+  std::size_t peak;   ///< maximum number of objects in use at the same time
+};
+
+/**
+ * @brief object pool for cci_value objects
+ *
+ * The representations of the top-level cci_value_list and cci_value_map
+ * objects are taken from a per-thread pool (cci_value objects store their
+ * representation inline), so that values can be created and destroyed
+ * concurrently from different threads without a global lock.  An object
+ * released on another thread than the one it was created on is handed back
+ * to its originating pool.
+ *
+ * @note This only covers the creation and destruction of values. Accessing
+ *       the same value from several threads still requires synchronisation.
+ */
+struct cci_value_pool
+{
+  /// statistics of the pool of the calling thread
+  static cci_value_pool_stats statistics();
+
+  /// maximum number of released objects kept per thread
+  static std::size_t limit();
+
+  /// set the maximum number of released objects kept per thread
+  static void set_limit( std::size_t max_pooled );
+};
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief constant cci_value tree held in a single memory region
+ *
+ * The nodes of a regular cci_value tree (list and map storage, copied
+ * strings) are allocated and freed one by one.  An arena instead takes
+ * all nodes of its tree from a region allocated in large chunks, and
+ * releases the region in bulk, without visiting the nodes.  This is meant
+ * for large trees that are built once and read afterwards, e.g. parsed
+ * configuration files or metadata maps.
+ *
+ * The tree is filled by copying a value or by parsing JSON, and is read
+ * through a cci_value_cref.  Copy it into a cci_value to modify it.
+ * References to the tree are invalidated when the arena is refilled,
+ * cleared or destroyed.
+ *
+ * Example:
+ * @code
+ * cci_value_arena presets;
+ * presets.from_json( config_file_contents );
+ * cci_value_map_cref map = presets.get().get_map();
+ * @endcode
+ */
+class cci_value_arena
+{
+public:
+  /// constructs an empty (null) tree, the region grows in chunks of the
+  /// given size
+  explicit cci_value_arena( std::size_t chunk_size = 64 * 1024 );
+
+  /// releases the region
+  ~cci_value_arena();
+
+  /// the tree held by the arena
+  cci_value_cref get() const;
+
+  /// replaces the tree by a (deep) copy of the given value
+  cci_value_cref assign( cci_value_cref value );
+
+  /// replaces the tree by the value of a JSON string
+  cci_value_cref from_json( std::string const & json );
+
+  /// releases the tree and the region (the tree is null afterwards)
+  void clear();
+
+  /// number of bytes reserved by the region
+  std::size_t capacity() const;
+
+private:
+  void* pimpl_;
+
+  // disabled
+  cci_value_arena( const cci_value_arena& );
+  cci_value_arena& operator=( const cci_value_arena& );
+};
+
+// --------------------------------------------------------------------------
+
 template<typename InputIt>
 cci_value_list_ref::iterator
 cci_value_list_ref::insert( const_iterator pos, InputIt first, InputIt last )
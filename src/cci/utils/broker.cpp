@@ -34,7 +34,48 @@ namespace cci_utils {
  */
   bool broker::sendToParent(const std::string &parname) const
   {
-    return  ((expose.find(parname) != expose.end()) && (!is_global_broker()));
+    if (is_global_broker())
+      return false;
+    if (expose.find(parname) != expose.end())
+      return true;
+    return matches_expose_pattern(parname);
+  }
+
+  bool broker::routeToParent(const std::string &parname) const
+  {
+    const param_registry::entry* e = m_registry.find(parname);
+    if (e && (e->param || e->forwarded))
+      return e->forwarded;
+    return sendToParent(parname);
+  }
+
+  bool broker::matches_expose_pattern(const std::string &parname) const
+  {
+    if (m_expose_patterns.empty())
+      return false;
+
+    const cci_name_atom name = cci_name_atom::lookup(parname);
+    if (!name.is_null()) {
+      std::unordered_map<cci_name_atom, bool, name_atom_hash>::const_iterator
+        it = m_exposed.find(name);
+      if (it != m_exposed.end())
+        return it->second;
+    }
+
+    bool result = false;
+    for (std::size_t i = 0; i < m_expose_patterns.size() && !result; ++i)
+      result = m_expose_patterns[i].matches(parname.c_str());
+
+    // only interned names are cached (i.e. names of parameters and presets)
+    if (!name.is_null())
+      m_exposed[name] = result;
+    return result;
+  }
+
+  void broker::expose_pattern(const std::string& pattern)
+  {
+    m_expose_patterns.push_back(param_pattern(pattern));
+    m_exposed.clear();
   }
 
 /*
@@ -53,7 +94,7 @@ namespace cci_utils {
 
   cci_originator broker::get_value_origin(const std::string &parname) const
   {
-    if (sendToParent(parname)) {
+    if (routeToParent(parname)) {
       return m_parent.get_value_origin(parname);
     } else {
       return consuming_broker::get_value_origin(parname);
@@ -62,7 +103,7 @@ namespace cci_utils {
   
   bool broker::has_preset_value(const std::string &parname) const
   {
-    if (sendToParent(parname)) {
+    if (routeToParent(parname)) {
       return m_parent.has_preset_value(parname);
     } else {
       return consuming_broker::has_preset_value(parname);
@@ -71,7 +112,7 @@ namespace cci_utils {
 
   cci_value broker::get_preset_cci_value(const std::string &parname) const
   {
-    if (sendToParent(parname)) {
+    if (routeToParent(parname)) {
       return m_parent.get_preset_cci_value(parname);
     } else {
       return consuming_broker::get_preset_cci_value(parname);
@@ -80,7 +121,7 @@ namespace cci_utils {
 
   void broker::lock_preset_value(const std::string &parname)
   {
-    if (sendToParent(parname)) {
+    if (routeToParent(parname)) {
       return m_parent.lock_preset_value(parname);
     } else {
       return consuming_broker::lock_preset_value(parname);
@@ -90,7 +131,7 @@ namespace cci_utils {
   cci_value broker::get_cci_value(const std::string &parname,
     const cci_originator &originator) const
   {
-    if (sendToParent(parname)) {
+    if (routeToParent(parname)) {
       return m_parent.get_cci_value(parname);
     } else {
       return consuming_broker::get_cci_value(parname);
@@ -100,17 +141,22 @@ namespace cci_utils {
   void broker::add_param(cci_param_if* par)
   {
     if (sendToParent(par->name())) {
-      return m_parent.add_param(par);
+      m_parent.add_param(par);
+      // keep the routing, even if the expose rules change later on
+      m_registry.insert(par->name()).forwarded = true;
     } else {
-      return consuming_broker::add_param(par);
+      consuming_broker::add_param(par);
     }
   }
 
   void broker::remove_param(cci_param_if* par) {
-    if (sendToParent(par->name())) {
-      return m_parent.remove_param(par);
+    param_registry::entry* e = m_registry.find(par->name());
+    if (e && e->forwarded) {
+      e->forwarded = false;
+      m_registry.release(*e);
+      m_parent.remove_param(par);
     } else {
-      return consuming_broker::remove_param(par);
+      consuming_broker::remove_param(par);
     }
   }
 
@@ -122,17 +168,73 @@ namespace cci_utils {
     const cci_value &cci_value,
     const cci_originator& originator)
   {
-    if (sendToParent(parname)) {
+    if (routeToParent(parname)) {
       return m_parent.set_preset_cci_value(parname,cci_value, originator);
     } else {
       return consuming_broker::set_preset_cci_value(parname,cci_value,originator);
     }
   }
+  std::vector<std::string> broker::merge_preset_cci_values(
+    const std::vector<cci_name_value_pair>& presets,
+    const cci_originator& originator)
+  {
+    if (is_global_broker() || (expose.empty() && m_expose_patterns.empty()))
+      return consuming_broker::merge_preset_cci_values(presets, originator);
+
+    std::vector<cci_name_value_pair> local, exposed;
+    std::vector<cci_name_value_pair>::const_iterator it;
+    for (it = presets.begin(); it != presets.end(); ++it)
+      (routeToParent(it->first) ? exposed : local).push_back(*it);
+
+    // the local half first, a foreign parent may report (and throw)
+    std::vector<std::string> rejected =
+      consuming_broker::merge_preset_cci_values(local, originator);
+    if (!exposed.empty()) {
+      consuming_broker* parent = dynamic_cast<consuming_broker*>(&m_parent);
+      std::vector<std::string> r = parent
+        ? parent->merge_preset_cci_values(exposed, originator)
+        : m_parent.set_preset_cci_values(exposed, originator);
+      rejected.insert(rejected.end(), r.begin(), r.end());
+    }
+    return rejected;
+  }
+
+  std::vector<std::string> broker::merge_preset_cci_values(
+    std::vector<cci_name_value_pair>&& presets,
+    const cci_originator& originator)
+  {
+    if (is_global_broker() || (expose.empty() && m_expose_patterns.empty()))
+      return consuming_broker::merge_preset_cci_values(CCI_MOVE_(presets),
+                                                       originator);
+
+    // split the batch without copying the values
+    std::vector<cci_name_value_pair> local, exposed;
+    std::vector<cci_name_value_pair>::iterator it;
+    for (it = presets.begin(); it != presets.end(); ++it) {
+      std::vector<cci_name_value_pair>& half =
+        routeToParent(it->first) ? exposed : local;
+      half.push_back(cci_name_value_pair());
+      half.back().first.swap(it->first);
+      half.back().second.swap(it->second);
+    }
+
+    std::vector<std::string> rejected =
+      consuming_broker::merge_preset_cci_values(CCI_MOVE_(local), originator);
+    if (!exposed.empty()) {
+      consuming_broker* parent = dynamic_cast<consuming_broker*>(&m_parent);
+      std::vector<std::string> r = parent
+        ? parent->merge_preset_cci_values(CCI_MOVE_(exposed), originator)
+        : m_parent.set_preset_cci_values(CCI_MOVE_(exposed), originator);
+      rejected.insert(rejected.end(), r.begin(), r.end());
+    }
+    return rejected;
+  }
+
   cci_param_untyped_handle broker::get_param_handle(
     const std::string &parname,
     const cci_originator& originator) const
   {
-    if (sendToParent(parname)) {
+    if (routeToParent(parname)) {
       return m_parent.get_param_handle(parname, originator);
     }
     cci_param_if* orig_param = get_orig_param(parname);
@@ -146,20 +248,155 @@ namespace cci_utils {
   }
 
 
+  cci_callback_untyped_handle
+    broker::register_pre_write_subscription(
+      const std::string& pattern,
+      const cci_param_pre_write_callback_untyped& cb,
+      const cci_originator& orig)
+  {
+    if (has_parent)
+      m_parent.register_pre_write_subscription(pattern, cb, orig);
+    return consuming_broker::register_pre_write_subscription(pattern, cb, orig);
+  }
+
+  cci_callback_untyped_handle
+    broker::register_post_write_subscription(
+      const std::string& pattern,
+      const cci_param_post_write_callback_untyped& cb,
+      const cci_originator& orig)
+  {
+    if (has_parent)
+      m_parent.register_post_write_subscription(pattern, cb, orig);
+    return consuming_broker::register_post_write_subscription(pattern, cb, orig);
+  }
+
+  cci_callback_untyped_handle
+    broker::register_pre_read_subscription(
+      const std::string& pattern,
+      const cci_param_pre_read_callback_untyped& cb,
+      const cci_originator& orig)
+  {
+    if (has_parent)
+      m_parent.register_pre_read_subscription(pattern, cb, orig);
+    return consuming_broker::register_pre_read_subscription(pattern, cb, orig);
+  }
+
+  cci_callback_untyped_handle
+    broker::register_post_read_subscription(
+      const std::string& pattern,
+      const cci_param_post_read_callback_untyped& cb,
+      const cci_originator& orig)
+  {
+    if (has_parent)
+      m_parent.register_post_read_subscription(pattern, cb, orig);
+    return consuming_broker::register_post_read_subscription(pattern, cb, orig);
+  }
+
+  bool broker::unregister_subscription(const cci_callback_untyped_handle& cb,
+                                       const cci_originator& orig)
+  {
+    if (!consuming_broker::unregister_subscription(cb, orig))
+      return false;
+    if (has_parent)
+      m_parent.unregister_subscription(cb, orig);
+    return true;
+  }
+
+  bool broker::unregister_all_callbacks(const cci_originator& orig)
+  {
+    // only the subscriptions have been passed up the broker stack
+    if (has_parent) {
+      for (std::size_t i = 0; i < m_subscriptions.size(); ++i) {
+        if (!m_subscriptions[i]->removed
+            && m_subscriptions[i]->originator == orig)
+          m_parent.unregister_subscription(m_subscriptions[i]->callback, orig);
+      }
+    }
+    return consuming_broker::unregister_all_callbacks(orig);
+  }
+
   std::vector<cci_param_untyped_handle>
-    broker::get_param_handles(const cci_originator& originator) const
+    broker::find_param_handles(const std::string& pattern,
+                               const cci_originator& originator) const
   {
+    std::vector<cci_param_untyped_handle> param_handles =
+      consuming_broker::find_param_handles(pattern, originator);
     if (has_parent) {
-      std::vector<cci_param_untyped_handle> p_param_handles=m_parent.get_param_handles();
-      std::vector<cci_param_untyped_handle> param_handles=consuming_broker::get_param_handles(originator);
-      // this is likely to be more efficient the other way round, but it keeps
-      // things consistent and means the local (mre useful) params will be at the
-      // head of the list.
-      param_handles.insert(param_handles.end(),p_param_handles.begin(), p_param_handles.end());
-      return param_handles;
-    } else {
-      return consuming_broker::get_param_handles(originator);
+      std::vector<cci_param_untyped_handle> p_param_handles;
+      const consuming_broker* parent =
+        dynamic_cast<const consuming_broker*>(&m_parent);
+      if (parent) {
+        p_param_handles = parent->find_param_handles(pattern, originator);
+      } else {
+        // no name index available, filter the full list
+        std::vector<cci_param_untyped_handle> all =
+          m_parent.get_param_handles(originator);
+        for (std::size_t i = 0; i < all.size(); ++i) {
+          if (param_registry::matches(pattern, all[i].name()))
+            p_param_handles.push_back(all[i]);
+        }
+      }
+      // local params first, as in get_param_handles
+      param_handles.insert(param_handles.end(),
+                           p_param_handles.begin(), p_param_handles.end());
+    }
+    return param_handles;
+  }
+
+  bool broker::visit_params(param_visitor& visitor,
+                            const cci_originator& originator) const
+  {
+    // the local (more useful) params are visited first
+    if (!consuming_broker::visit_params(visitor, originator))
+      return false;
+    if (!has_parent)
+      return true;
+
+    const consuming_broker* parent =
+      dynamic_cast<const consuming_broker*>(&m_parent);
+    if (parent)
+      return parent->visit_params(visitor, originator);
+
+    // parameters of a foreign parent broker are only reachable via handles
+    std::vector<cci_param_untyped_handle> handles =
+      m_parent.get_param_handles(originator);
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+      if (!visitor.visit_handle(handles[i]))
+        return false;
+    }
+    return true;
+  }
+
+  bool broker::visit_changed_params(cci::uint64 generation,
+                                    param_visitor& visitor,
+                                    const cci_originator& originator) const
+  {
+    if (!consuming_broker::visit_changed_params(generation, visitor,
+                                                originator))
+      return false;
+    if (!has_parent)
+      return true;
+
+    const consuming_broker* parent =
+      dynamic_cast<const consuming_broker*>(&m_parent);
+    if (parent)
+      return parent->visit_changed_params(generation, visitor, originator);
+
+    std::vector<cci_param_untyped_handle> handles =
+      m_parent.get_changed_param_handles(generation, originator);
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+      if (!visitor.visit_handle(handles[i]))
+        return false;
     }
+    return true;
+  }
+
+  std::shared_ptr<const cci_param_handle_sequence::param_list>
+    broker::lazy_params() const
+  {
+    if (has_parent)
+      return std::shared_ptr<const cci_param_handle_sequence::param_list>();
+    return consuming_broker::lazy_params();
   }
 
   bool broker::is_global_broker() const
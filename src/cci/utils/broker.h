@@ -23,6 +23,8 @@
 #include "cci/utils/consuming_broker.h"
 #include "cci/cfg/cci_broker_manager.h"
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 namespace cci_utils 
 {
@@ -40,7 +42,37 @@ namespace cci_utils
 // a set of perameters that should be exposed up the broker stack
     std::set<std::string> expose;
 
+    /// Expose all parameters matching a name pattern up the broker stack
+    /**
+     * In addition to the names listed in @ref expose, all names matching
+     * one of the given patterns are sent to the parent broker, e.g.
+     * "top.cpu.**" exposes top.cpu and the complete subtree below it.
+     *
+     * The patterns are evaluated once per name, the routing decision is
+     * cached.  A parameter keeps the routing decided when it has been
+     * added, i.e. rules added later only affect new parameters and
+     * preset values.
+     *
+     * @param pattern name pattern, see param_pattern
+     */
+    void expose_pattern(const std::string& pattern);
+
   private:
+    struct name_atom_hash
+    {
+      std::size_t operator()(const cci::cci_name_atom& name) const
+        { return name.hash(); }
+    };
+
+    /// Compiled expose patterns
+    std::vector<param_pattern> m_expose_patterns;
+
+    /// Cached result of matching a name against the expose patterns
+    mutable std::unordered_map<cci::cci_name_atom, bool, name_atom_hash>
+      m_exposed;
+
+    bool matches_expose_pattern(const std::string &parname) const;
+
     /// for the public broker, this will be useless, but if people re-use this
     /// broker, then it will help
     bool has_parent;
@@ -60,6 +92,9 @@ namespace cci_utils
     }
 
     bool sendToParent(const std::string &parname) const;
+    /// routing of a registered parameter (decided by add_param), falls back
+    /// to sendToParent for other names
+    bool routeToParent(const std::string &parname) const;
 
   public:
 
@@ -94,16 +129,83 @@ namespace cci_utils
     cci::cci_param_untyped_handle get_param_handle(const std::string &parname,
                                                    const cci::cci_originator& originator) const;
 
-    /// return a list of all the params that the originator can see from either
-    /// the private broker, or from up the broker stack.
-    std::vector<cci::cci_param_untyped_handle> get_param_handles(const cci::cci_originator& originator) const;
+    /// return handles of all the params matching the given name pattern,
+    /// from either the private broker, or from up the broker stack.
+    std::vector<cci::cci_param_untyped_handle>
+    find_param_handles(const std::string& pattern,
+                       const cci::cci_originator& originator) const;
 
     void add_param(cci::cci_param_if* par);
 
     void remove_param(cci::cci_param_if* par);
 
+    /** @name Parameter access subscriptions
+     *
+     * Subscriptions are registered with this broker and passed up the
+     * broker stack, so that they cover the exposed parameters as well.  As
+     * for get_param_handles(), the parameters of the parent brokers are
+     * visible through this broker, i.e. a subscription also observes the
+     * matching parameters of the parent brokers.
+     */
+    //@{
+    cci::cci_callback_untyped_handle
+    register_pre_write_subscription(
+      const std::string& pattern,
+      const cci::cci_param_pre_write_callback_untyped& cb,
+      const cci::cci_originator& orig);
+
+    cci::cci_callback_untyped_handle
+    register_post_write_subscription(
+      const std::string& pattern,
+      const cci::cci_param_post_write_callback_untyped& cb,
+      const cci::cci_originator& orig);
+
+    cci::cci_callback_untyped_handle
+    register_pre_read_subscription(
+      const std::string& pattern,
+      const cci::cci_param_pre_read_callback_untyped& cb,
+      const cci::cci_originator& orig);
+
+    cci::cci_callback_untyped_handle
+    register_post_read_subscription(
+      const std::string& pattern,
+      const cci::cci_param_post_read_callback_untyped& cb,
+      const cci::cci_originator& orig);
+
+    bool unregister_subscription(const cci::cci_callback_untyped_handle& cb,
+                                 const cci::cci_originator& orig);
+
+    bool unregister_all_callbacks(const cci::cci_originator& orig);
+    //@}
+
     bool is_global_broker() const;
-    
+
+  protected:
+    /// apply the local presets, and pass the exposed ones up the broker
+    /// stack as a single batch
+    std::vector<std::string> merge_preset_cci_values(
+      const std::vector<cci::cci_name_value_pair>& presets,
+      const cci::cci_originator& originator);
+
+    /// @copydoc merge_preset_cci_values(const std::vector<cci::cci_name_value_pair>&, const cci::cci_originator&)
+    std::vector<std::string> merge_preset_cci_values(
+      std::vector<cci::cci_name_value_pair>&& presets,
+      const cci::cci_originator& originator);
+
+    /// visit the params of the private broker, followed by the params
+    /// up the broker stack
+    bool visit_params(param_visitor& visitor,
+                      const cci::cci_originator& originator) const;
+
+    /// visit the written params of the private broker, followed by the
+    /// written params up the broker stack
+    bool visit_changed_params(cci::uint64 generation,
+                              param_visitor& visitor,
+                              const cci::cci_originator& originator) const;
+
+    /// no lazy ranges, if the params of a parent broker are visible
+    std::shared_ptr<const cci::cci_param_handle_sequence::param_list>
+      lazy_params() const;
   };
 
 }
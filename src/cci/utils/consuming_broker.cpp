@@ -22,21 +22,265 @@
  */
 
 #include "cci/utils/consuming_broker.h"
+#include "cci/cfg/cci_param_untyped.h"
+
+#include <algorithm>
+#include <sstream>
 
 
 namespace cci_utils {
   using namespace cci;
+
+  namespace {
+    /// appends handles of the visited parameters
+    struct handle_collector : consuming_broker::param_visitor
+    {
+      handle_collector(std::vector<cci_param_untyped_handle>& h,
+                       const cci_originator& orig)
+        : handles(h), originator(orig) {}
+
+      bool visit_param(cci_param_if& param)
+      {
+        handles.push_back(cci_param_untyped_handle(param, originator));
+        return true;
+      }
+
+      bool visit_handle(const cci_param_untyped_handle& handle)
+        { handles.push_back(handle); return true; }
+
+      std::vector<cci_param_untyped_handle>& handles;
+      const cci_originator& originator;
+    };
+
+    /// appends the visited parameters
+    struct param_collector : consuming_broker::param_visitor
+    {
+      explicit param_collector(std::vector<cci_param_if*>& p)
+        : params(p) {}
+
+      bool visit_param(cci_param_if& param)
+        { params.push_back(&param); return true; }
+
+      std::vector<cci_param_if*>& params;
+    };
+
+    /// forwards the parameters written since a generation to a visitor
+    struct changed_filter : consuming_broker::param_visitor
+    {
+      changed_filter(consuming_broker::param_visitor& v, uint64 g)
+        : visitor(v), generation(g) {}
+
+      bool visit_param(cci_param_if& param)
+      {
+        return param.get_write_generation() <= generation
+               || visitor.visit_param(param);
+      }
+
+      bool visit_handle(const cci_param_untyped_handle& handle)
+      {
+        return handle.get_write_generation() <= generation
+               || visitor.visit_handle(handle);
+      }
+
+      consuming_broker::param_visitor& visitor;
+      uint64 generation;
+    };
+
+    bool param_name_less(const cci_param_if* a, const cci_param_if* b)
+    {
+      return param_registry::name_less(a->name(), b->name());
+    }
+
+    /// forwards the registered parameters of registry entries to a visitor
+    struct entry_visitor
+    {
+      explicit entry_visitor(consuming_broker::param_visitor& v)
+        : visitor(v) {}
+
+      bool operator()(const param_registry::entry& e) const
+        { return !e.param || visitor.visit_param(*e.param); }
+
+      consuming_broker::param_visitor& visitor;
+    };
+
+    /// passes views of the visited parameters to a user visitor
+    struct view_visitor : consuming_broker::param_visitor
+    {
+      view_visitor(const cci_param_visitor& v, const cci_originator& orig)
+        : visitor(v), originator(orig) {}
+
+      bool visit_param(cci_param_if& param)
+        { return visitor(cci_param_view(param, originator)); }
+
+      bool visit_handle(const cci_param_untyped_handle& handle)
+        { return visitor(cci_param_view(handle)); }
+
+      const cci_param_visitor& visitor;
+      const cci_originator& originator;
+    };
+
+    bool name_value_less(const cci_name_value_pair& a,
+                         const cci_name_value_pair& b)
+    {
+      return param_registry::name_less(a.first.c_str(), b.first.c_str());
+    }
+
+    bool is_ignored(const std::vector<cci_preset_value_predicate>& predicates,
+                    const cci_name_value_pair& preset)
+    {
+      std::vector<cci_preset_value_predicate>::const_iterator pred;
+      for (pred = predicates.begin(); pred != predicates.end(); ++pred) {
+        const cci_preset_value_predicate &p=*pred; // get the actual predicate
+        if (p(preset))
+          return true;
+      }
+      return false;
+    }
+  }
   
+  /// Dispatches the observed parameter accesses to the subscriptions
+  /**
+   * A single observer is attached to all observed parameters of a broker.
+   * The matching subscriptions are looked up on each access, and the
+   * parameter handle passed to a subscriber only lives on the stack of
+   * the dispatch, i.e. the subscriptions take no memory per parameter.
+   *
+   * Subscriptions unregistered during a dispatch are only marked removed
+   * and erased when the outermost dispatch is complete.  Subscriptions
+   * registered during a dispatch are not invoked for the current access.
+   */
+  class consuming_broker::param_observer : public cci_param_observer_if
+  {
+  public:
+    explicit param_observer(consuming_broker& b) : m_broker(b) {}
+
+    bool pre_write(cci_param_if& param,
+                   const cci_impl::lazy_value& old_value,
+                   const cci_impl::lazy_value& new_value,
+                   const cci_originator& originator)
+    {
+      bool result = true;
+      dispatch_scope scope(m_broker);
+      for (std::size_t i = 0; i < scope.size(); ++i) {
+        const subscription* s =
+          scope.match(i, CCI_PARAM_PRE_WRITE_EVENT, param);
+        if (!s)
+          continue;
+        const cci_param_untyped_handle handle(param, s->originator);
+        const cci_param_write_event<>
+          ev(old_value, new_value, originator, handle);
+        if (!s->callback.unchecked_invoke<bool,
+              const cci_param_write_event<>&>(ev))
+          result = false;
+      }
+      return result;
+    }
+
+    void post_write(cci_param_if& param,
+                    const cci_impl::lazy_value& old_value,
+                    const cci_impl::lazy_value& new_value,
+                    const cci_originator& originator)
+    {
+      dispatch_scope scope(m_broker);
+      for (std::size_t i = 0; i < scope.size(); ++i) {
+        const subscription* s =
+          scope.match(i, CCI_PARAM_POST_WRITE_EVENT, param);
+        if (!s)
+          continue;
+        const cci_param_untyped_handle handle(param, s->originator);
+        const cci_param_write_event<>
+          ev(old_value, new_value, originator, handle);
+        s->callback.unchecked_invoke<void,
+          const cci_param_write_event<>&>(ev);
+      }
+    }
+
+    void pre_read(cci_param_if& param,
+                  const cci_impl::lazy_value& value,
+                  const cci_originator& originator)
+      { read(CCI_PARAM_PRE_READ_EVENT, param, value, originator); }
+
+    void post_read(cci_param_if& param,
+                   const cci_impl::lazy_value& value,
+                   const cci_originator& originator)
+      { read(CCI_PARAM_POST_READ_EVENT, param, value, originator); }
+
+  private:
+    /// Marks a dispatch, purges the removed subscriptions at the end of
+    /// the outermost one
+    class dispatch_scope
+    {
+    public:
+      explicit dispatch_scope(consuming_broker& b)
+        : m_broker(b), m_size(b.m_subscriptions.size())
+        { ++m_broker.m_dispatching; }
+      ~dispatch_scope()
+      {
+        if (--m_broker.m_dispatching == 0)
+          m_broker.purge_subscriptions();
+      }
+
+      /// Number of subscriptions at the start of the dispatch
+      std::size_t size() const { return m_size; }
+
+      /// The i-th subscription, if it matches the event and the parameter
+      const subscription* match(std::size_t i, int event,
+                                const cci_param_if& param) const
+      {
+        const subscription* s = m_broker.m_subscriptions[i].get();
+        if (s->removed || s->event != event
+            || !s->pattern.matches(param.name()))
+          return NULL;
+        return s;
+      }
+
+    private:
+      consuming_broker& m_broker;
+      const std::size_t m_size;
+    };
+
+    void read(int event, cci_param_if& param,
+              const cci_impl::lazy_value& value,
+              const cci_originator& originator)
+    {
+      dispatch_scope scope(m_broker);
+      for (std::size_t i = 0; i < scope.size(); ++i) {
+        const subscription* s = scope.match(i, event, param);
+        if (!s)
+          continue;
+        const cci_param_untyped_handle handle(param, s->originator);
+        const cci_param_read_event<> ev(value, originator, handle);
+        s->callback.unchecked_invoke<void,
+          const cci_param_read_event<>&>(ev);
+      }
+    }
+
+    consuming_broker& m_broker;
+  };
+
 // NB this broker must be instanced and registered in the same place
 //
   consuming_broker::consuming_broker(const std::string& name)
     : m_name(cci_gen_unique_name(name.c_str()))
+    , m_lazy_param_ranges(false)
+    , m_untracked_params(0)
+    , m_observer(new param_observer(*this))
+    , m_dispatching(0)
+    , m_removed_subscriptions(false)
     {
       sc_assert (name.length() > 0 && "Name must not be empty");
     }
 
   consuming_broker::~consuming_broker()
   {
+    // detach from the parameters outliving this broker
+    param_registry::const_iterator it;
+    for (it = m_registry.begin(); it != m_registry.end(); ++it) {
+      if ((*it)->param) {
+        (*it)->param->set_write_list(NULL);
+        (*it)->param->set_observer(NULL, 0);
+      }
+    }
   }
 
   const char* consuming_broker::name() const
@@ -49,50 +293,138 @@ namespace cci_utils {
     const cci_value & value,
     const cci_originator& originator)
   {
-    if (locked.find(parname) != locked.end()) {
+    param_registry::entry& e = m_registry.insert(parname);
+    if (e.locked) {
       cci_report_handler::set_param_failed("Setting preset value failed (parameter locked).");
       return;
     }
 
-    std::map<std::string,cci_value>::const_iterator iter =
-      m_used_value_registry.find(parname);
-    if (iter != m_used_value_registry.end() ) {
-      m_used_value_registry[parname]=value; // kiss a zombee
-      /* here, one could build a broker that, e.g. allowed writes to a param
-         during elaboration. We choose not to, the user may reset the value at eoe
-         if they choose*/
-    } else {
-      m_unused_value_registry[parname] = value;
+    // If the preset has already been consumed, we just kiss a zombee.
+    /* here, one could build a broker that, e.g. allowed writes to a param
+       during elaboration. We choose not to, the user may reset the value at eoe
+       if they choose*/
+    e.preset = value;
+    e.has_preset = true;
+    // Store originator of the preset value.
+    e.preset_originator = shared_preset_originator(originator);
+  }
+
+  std::vector<std::string> consuming_broker::set_preset_cci_values(
+    const std::vector<cci_name_value_pair>& presets,
+    const cci_originator& originator)
+  {
+    // report once, after the whole batch has been applied
+    std::vector<std::string> rejected =
+      merge_preset_cci_values(presets, originator);
+    report_rejected_presets(rejected);
+    return rejected;
+  }
+
+  std::vector<std::string> consuming_broker::set_preset_cci_values(
+    std::vector<cci_name_value_pair>&& presets,
+    const cci_originator& originator)
+  {
+    std::vector<std::string> rejected =
+      merge_preset_cci_values(CCI_MOVE_(presets), originator);
+    report_rejected_presets(rejected);
+    return rejected;
+  }
+
+  void consuming_broker::report_rejected_presets(
+    const std::vector<std::string>& rejected)
+  {
+    if (!rejected.empty()) {
+      std::ostringstream msg;
+      msg << "Setting preset values failed (" << rejected.size()
+          << " parameter(s) locked, e.g. '" << rejected.front() << "').";
+      cci_report_handler::set_param_failed(msg.str().c_str());
+    }
+  }
+
+  std::vector<std::string> consuming_broker::merge_preset_cci_values(
+    const std::vector<cci_name_value_pair>& presets,
+    const cci_originator& originator)
+  {
+    // the batch is not modified, if the values are not taken over
+    return merge_presets(const_cast<std::vector<cci_name_value_pair>&>(presets),
+                         originator, false);
+  }
+
+  std::vector<std::string> consuming_broker::merge_preset_cci_values(
+    std::vector<cci_name_value_pair>&& presets,
+    const cci_originator& originator)
+  {
+    return merge_presets(presets, originator, true);
+  }
+
+  std::vector<std::string> consuming_broker::merge_presets(
+    std::vector<cci_name_value_pair>& presets,
+    const cci_originator& originator,
+    bool take_values)
+  {
+    std::vector<std::string> rejected;
+    // a single originator copy for the whole batch
+    const std::shared_ptr<const cci_originator> origin =
+      shared_preset_originator(originator);
+
+    // make room for the whole batch, to merge it without rehashing
+    m_registry.reserve(m_registry.size() + presets.size());
+
+    std::vector<cci_name_value_pair>::iterator it;
+    for (it = presets.begin(); it != presets.end(); ++it) {
+      param_registry::entry& e = m_registry.insert(cci_name_atom(it->first));
+      if (e.locked) {
+        rejected.push_back(it->first);
+        continue;
+      }
+      if (take_values)
+        e.preset.swap(it->second);
+      else
+        e.preset = it->second;
+      e.has_preset = true;
+      e.preset_originator = origin;
     }
+    return rejected;
+  }
 
-    // Store originator of the preset value. Can't use index operator since
-    // null construction of an originator is prohibited outside the module hierarchy.
-    // m_preset_value_originator_map[parname] = originator;
-    std::map<std::string, cci_originator>::iterator it;
-    it = m_preset_value_originator_map.find(parname);
-    if (it != m_preset_value_originator_map.end())
-        it->second = originator;
-    else 
-        m_preset_value_originator_map.insert(
-            std::pair<std::string, cci_originator>(parname, originator));
+  std::shared_ptr<const cci_originator>
+    consuming_broker::shared_preset_originator(const cci_originator& originator)
+  {
+    // consecutive presets are usually set by the same originator
+    if (!m_preset_originator || !(*m_preset_originator == originator))
+      m_preset_originator = std::make_shared<const cci_originator>(originator);
+    return m_preset_originator;
   }
 
   std::vector<cci_name_value_pair> consuming_broker::get_unconsumed_preset_values() const
   {
     std::vector<cci_name_value_pair> unconsumed_preset_cci_values;
-    std::map<std::string, cci_value>::const_iterator iter;
-    std::vector<cci_preset_value_predicate>::const_iterator pred;
+    std::vector<const param_registry::entry*> entries = m_registry.sorted();
+    std::vector<const param_registry::entry*>::const_iterator iter;
+
+    for( iter = entries.begin(); iter != entries.end(); ++iter ) {
+      const param_registry::entry& e = **iter;
+      if (!e.has_preset || e.consumed)
+        continue;
+      const cci_name_value_pair preset(e.name.c_str(), e.preset);
+      if (!is_ignored(m_ignored_unconsumed_predicates, preset))
+        unconsumed_preset_cci_values.push_back(preset);
+    }
 
-    for( iter = m_unused_value_registry.begin(); iter != m_unused_value_registry.end(); ++iter ) {
-      for (pred =  m_ignored_unconsumed_predicates.begin(); pred !=  m_ignored_unconsumed_predicates.end(); ++pred) {
-        const cci_preset_value_predicate &p=*pred; // get the actual predicate
-        if (p(std::make_pair(iter->first, iter->second))) {
-          break;
-        }
-      }
-      if (pred==m_ignored_unconsumed_predicates.end()) {
-        unconsumed_preset_cci_values.push_back(std::make_pair(iter->first, iter->second));
+    if (m_bundle) {
+      // bundled presets, which are neither consumed nor overridden
+      for (std::size_t i = 0; i < m_bundle->size(); ++i) {
+        if (m_bundle_consumed[i])
+          continue;
+        const param_registry::entry* e = m_registry.find(m_bundle->name(i));
+        if (e && e->has_preset)
+          continue;
+        const cci_name_value_pair preset(m_bundle->name(i), m_bundle->value(i));
+        if (!is_ignored(m_ignored_unconsumed_predicates, preset))
+          unconsumed_preset_cci_values.push_back(preset);
       }
+      std::sort(unconsumed_preset_cci_values.begin(),
+                unconsumed_preset_cci_values.end(), name_value_less);
     }
     return unconsumed_preset_cci_values;
   }
@@ -110,14 +442,16 @@ namespace cci_utils {
 
   cci_originator consuming_broker::get_value_origin(const std::string &parname) const
   {
-    cci_param_if* p = get_orig_param(parname);
-    if (p) {
-      return p->get_value_origin();
+    const param_registry::entry* e = m_registry.find(parname);
+    if (e && e->param) {
+      return e->param->get_value_origin();
+    }
+    if (e && e->has_preset) {
+      return *e->preset_originator;
     }
-    std::map<std::string, cci_originator>::const_iterator it;
-    it = m_preset_value_originator_map.find(parname);
-    if (it != m_preset_value_originator_map.end()) {
-      return it->second;
+    const std::size_t i = bundled_preset(parname);
+    if (i != preset_bundle::npos) {
+      return m_bundle->originator(i);
     }
     // if the param doesn't exist, we should return 'unkown_originator'
     return cci_broker_if::unknown_originator();
@@ -125,29 +459,25 @@ namespace cci_utils {
 
   cci_originator consuming_broker::get_preset_value_origin(const std::string &parname) const
   {
-    std::map<std::string, cci_originator>::const_iterator it;
-    it = m_preset_value_originator_map.find(parname);
-    if (it != m_preset_value_originator_map.end())
-      return it->second;
+    const param_registry::entry* e = m_registry.find(parname);
+    if (e && e->has_preset)
+      return *e->preset_originator;
+    const std::size_t i = bundled_preset(parname);
+    if (i != preset_bundle::npos)
+      return m_bundle->originator(i);
     // if no preset value, return 'unknown originator'
     return cci_broker_if::unknown_originator();
   }
 
   cci_value consuming_broker::get_preset_cci_value(const std::string &parname) const
   {
-    {
-      std::map<std::string,cci_value>::const_iterator iter =
-        m_used_value_registry.find(parname);
-      if (iter != m_used_value_registry.end() ) {
-        return iter->second;
-      }
+    const param_registry::entry* e = m_registry.find(parname);
+    if (e && e->has_preset) {
+      return e->preset;
     }
-    {
-      std::map<std::string,cci_value>::const_iterator iter =
-        m_unused_value_registry.find(parname);
-      if (iter != m_unused_value_registry.end() ) {
-        return iter->second;
-      }
+    const std::size_t i = bundled_preset(parname);
+    if (i != preset_bundle::npos) {
+      return m_bundle->value(i);
     }
 // If there is nothing in the database, return NULL.
     return cci_value();
@@ -156,20 +486,23 @@ namespace cci_utils {
   void consuming_broker::lock_preset_value(const std::string &parname)
   {
     // no error is possible. Even if the parameter does not yet exist.
-    locked.insert(parname);
+    m_registry.insert(parname).locked = true;
   }
 
   cci_value consuming_broker::get_cci_value(const std::string &parname,
     const cci_originator &originator) const
   {
-    cci_param_if* p = get_orig_param(parname);
-    if(p) {
-      return p->get_cci_value(originator);
+    const param_registry::entry* e = m_registry.find(parname);
+    if (e && e->param) {
+      return e->param->get_cci_value(originator);
     } else {
-      std::map<std::string,cci_value>::const_iterator iter =
-        m_unused_value_registry.find(parname);
-      if (iter != m_unused_value_registry.end() ) {
-        return iter->second;
+      if (e && e->has_preset && !e->consumed) {
+        return e->preset;
+      }
+      const std::size_t i = bundled_preset(parname);
+      if (i != preset_bundle::npos && !m_bundle_consumed[i]
+          && !(e && e->has_preset)) {
+        return m_bundle->value(i);
       }
       cci_report_handler::get_param_failed("Unable to find the parameter to get value");
       return cci_value();
@@ -179,14 +512,8 @@ namespace cci_utils {
   cci_param_if* consuming_broker::get_orig_param(
     const std::string &parname) const
   {
-    std::map<std::string,cci_param_if*>::const_iterator iter =
-      m_param_registry.find(parname);
-    if( iter != m_param_registry.end() ) {
-      cci_param_if* ret = iter->second;
-      sc_assert(ret != NULL && "This param shall be a cci_param_if!");
-      return ret;
-    }
-    else return NULL;
+    const param_registry::entry* e = m_registry.find(parname);
+    return e ? e->param : NULL;
   }
 
 /*
@@ -212,21 +539,14 @@ namespace cci_utils {
 
   bool consuming_broker::has_preset_value(const std::string &parname) const
   {
-    {
-      std::map<std::string,cci_value>::const_iterator iter =
-        m_used_value_registry.find(parname);
-      if (iter != m_used_value_registry.end() ) {
-        return true;
-      }
-    }
-    {
-      std::map<std::string,cci_value>::const_iterator iter =
-        m_unused_value_registry.find(parname);
-      if (iter != m_unused_value_registry.end() ) {
-        return true;
-      }
-    }
-    return false;
+    const param_registry::entry* e = m_registry.find(parname);
+    return (e && e->has_preset)
+        || bundled_preset(parname) != preset_bundle::npos;
+  }
+
+  std::size_t consuming_broker::bundled_preset(const std::string& parname) const
+  {
+    return m_bundle ? m_bundle->find(parname) : preset_bundle::npos;
   }
 
   cci_param_create_callback_handle
@@ -275,6 +595,116 @@ namespace cci_utils {
     return false;
   }
 
+  cci_callback_untyped_handle
+    consuming_broker::register_pre_write_subscription(
+      const std::string& pattern,
+      const cci_param_pre_write_callback_untyped& cb,
+      const cci_originator& orig) {
+    return subscribe(pattern, cb, CCI_PARAM_PRE_WRITE_EVENT, orig);
+  }
+
+  cci_callback_untyped_handle
+    consuming_broker::register_post_write_subscription(
+      const std::string& pattern,
+      const cci_param_post_write_callback_untyped& cb,
+      const cci_originator& orig) {
+    return subscribe(pattern, cb, CCI_PARAM_POST_WRITE_EVENT, orig);
+  }
+
+  cci_callback_untyped_handle
+    consuming_broker::register_pre_read_subscription(
+      const std::string& pattern,
+      const cci_param_pre_read_callback_untyped& cb,
+      const cci_originator& orig) {
+    return subscribe(pattern, cb, CCI_PARAM_PRE_READ_EVENT, orig);
+  }
+
+  cci_callback_untyped_handle
+    consuming_broker::register_post_read_subscription(
+      const std::string& pattern,
+      const cci_param_post_read_callback_untyped& cb,
+      const cci_originator& orig) {
+    return subscribe(pattern, cb, CCI_PARAM_POST_READ_EVENT, orig);
+  }
+
+  cci_callback_untyped_handle
+    consuming_broker::subscribe(const std::string& pattern,
+                                const cci_callback_untyped_handle& cb,
+                                int event,
+                                const cci_originator& orig) {
+    m_subscriptions.push_back(std::make_shared<subscription>(
+      pattern, cb, event, orig));
+    update_observed_events(pattern);
+    return cb;
+  }
+
+  void consuming_broker::unsubscribe(std::size_t index)
+  {
+    const std::shared_ptr<subscription> s = m_subscriptions[index];
+    if (m_dispatching) {
+      // the dispatch in progress iterates the subscriptions by index
+      s->removed = true;
+      m_removed_subscriptions = true;
+    } else {
+      m_subscriptions.erase(m_subscriptions.begin() + index);
+    }
+    update_observed_events(s->pattern.str());
+  }
+
+  void consuming_broker::purge_subscriptions()
+  {
+    if (!m_removed_subscriptions)
+      return;
+    std::vector<std::shared_ptr<subscription> >::iterator it;
+    for (it = m_subscriptions.begin(); it != m_subscriptions.end(); ) {
+      if ((*it)->removed)
+        it = m_subscriptions.erase(it);
+      else
+        ++it;
+    }
+    m_removed_subscriptions = false;
+  }
+
+  bool
+    consuming_broker::unregister_subscription(
+      const cci_callback_untyped_handle& cb,
+      const cci_originator& orig) {
+    for (std::size_t i = 0; i < m_subscriptions.size(); ++i)
+    {
+      if (!m_subscriptions[i]->removed &&
+          m_subscriptions[i]->callback == cb &&
+          m_subscriptions[i]->originator == orig) {
+        unsubscribe(i);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void consuming_broker::observe(cci_param_if& param)
+  {
+    int events = 0;
+    std::vector<std::shared_ptr<subscription> >::const_iterator it;
+    for (it = m_subscriptions.begin(); it != m_subscriptions.end(); ++it) {
+      const subscription& s = **it;
+      if (!s.removed && !(events & s.event)
+          && s.pattern.matches(param.name()))
+        events |= s.event;
+    }
+    param.set_observer(m_observer.get(), events);
+  }
+
+  void consuming_broker::update_observed_events(const std::string& pattern)
+  {
+    std::vector<const param_registry::entry*> entries =
+      m_registry.match(pattern);
+    std::vector<const param_registry::entry*>::const_iterator it;
+    for (it = entries.begin(); it != entries.end(); ++it) {
+      if ((*it)->param)
+        observe(*(*it)->param);
+    }
+  }
+
   bool consuming_broker::unregister_all_callbacks(
     const cci_originator &orig) {
     bool result = false;
@@ -295,27 +725,47 @@ namespace cci_utils {
         result = true;
       }
     }
+    for (std::size_t i = m_subscriptions.size(); i-- > 0; )
+    {
+      if (!m_subscriptions[i]->removed &&
+          m_subscriptions[i]->originator == orig) {
+        unsubscribe(i);
+        result = true;
+      }
+    }
     return result;
   }
 
   bool consuming_broker::has_callbacks() const {
     return (!m_create_callbacks.empty() ||
-            !m_destroy_callbacks.empty());
+            !m_destroy_callbacks.empty() ||
+            !m_subscriptions.empty());
   }
 
   void consuming_broker::add_param(cci_param_if* par) {
     sc_assert(par != NULL && "Unable to add a NULL parameter");
-    const std::string &par_name = par->name();
-    bool new_element = m_param_registry.insert(
-      std::pair<std::string, cci_param_if*>(par_name, par)).second;
-    sc_assert(new_element && "The same parameter had been added twice!!");
-
-    std::map<std::string,cci_value>::iterator iter =
-      m_unused_value_registry.find(par_name);
-    if (iter != m_unused_value_registry.end()  ) {
-      m_used_value_registry.insert(std::make_pair(iter->first, iter->second));
-      m_unused_value_registry.erase(iter);
+    sc_assert(!m_registry.is_walking()
+              && "Parameters must not be created while visiting them");
+    param_registry::entry& e =
+      m_registry.insert(par->name());
+    sc_assert(!e.param && "The same parameter had been added twice!!");
+    e.param = par;
+    m_lazy_params.reset();
+    if (!par->set_write_list(&m_written))
+      ++m_untracked_params;
+    if (e.has_preset) {
+      e.consumed = true;
     }
+    if (m_bundle) {
+      const std::size_t i = m_bundle->find(par->name());
+      if (i != preset_bundle::npos)
+        m_bundle_consumed[i] = true;
+    }
+
+    // Subscriptions
+    if (!m_subscriptions.empty())
+      observe(*par);
+
     // Create callbacks
     for (unsigned i = 0; i < m_create_callbacks.size(); ++i) {
       m_create_callbacks[i].callback.invoke(
@@ -325,30 +775,57 @@ namespace cci_utils {
 
   void consuming_broker::remove_param(cci_param_if* par) {
     sc_assert(par != NULL && "Unable to remove a NULL parameter");
-    m_param_registry.erase(par->name());
+    sc_assert(!m_registry.is_walking()
+              && "Parameters must not be destroyed while visiting them");
+    param_registry::entry* e = m_registry.find(par->name());
+    if (e) {
+      // ranges still referring to the parameter must not access it
+      if (m_lazy_params) {
+        m_lazy_params->valid = false;
+        m_lazy_params.reset();
+      }
+      if (e->param && !par->set_write_list(NULL))
+        --m_untracked_params;
+      par->set_observer(NULL, 0);
+      // a consumed preset value becomes unconsumed again
+      e->param = NULL;
+      e->consumed = false;
+      m_registry.release(*e);
+    }
+    if (m_bundle) {
+      const std::size_t i = m_bundle->find(par->name());
+      if (i != preset_bundle::npos)
+        m_bundle_consumed[i] = false;
+    }
 
     // Destroy callbacks
     for (unsigned i = 0; i < m_destroy_callbacks.size(); ++i) {
         m_destroy_callbacks[i].callback.invoke(
             par->create_param_handle(par->get_originator()));
     }
-
-    std::map<std::string,cci_value>::iterator iter =
-      m_used_value_registry.find(par->name());
-    if (iter != m_used_value_registry.end()  ) {
-      m_unused_value_registry.insert(std::make_pair(iter->first, iter->second));
-      m_used_value_registry.erase(iter);    
-    }
   }
 
   std::vector<cci_param_untyped_handle>
     consuming_broker::get_param_handles(const cci_originator& originator) const
   {
     std::vector<cci_param_untyped_handle> param_handles;
-    std::map<std::string,cci_param_if*>::const_iterator it;
-    for (it=m_param_registry.begin(); it != m_param_registry.end(); ++it) {
-      cci_param_if* p = it->second;
-      param_handles.push_back(cci_param_untyped_handle(*p, originator));
+    handle_collector collector(param_handles, originator);
+    visit_params(collector, originator);
+    return param_handles;
+  }
+
+  std::vector<cci_param_untyped_handle>
+    consuming_broker::find_param_handles(const std::string& pattern,
+                                         const cci_originator& originator) const
+  {
+    std::vector<cci_param_untyped_handle> param_handles;
+    std::vector<const param_registry::entry*> entries =
+      m_registry.match(pattern);
+    std::vector<const param_registry::entry*>::const_iterator it;
+    for (it = entries.begin(); it != entries.end(); ++it) {
+      cci_param_if* p = (*it)->param;
+      if (p)
+        param_handles.push_back(cci_param_untyped_handle(*p, originator));
     }
     return param_handles;
   }
@@ -357,10 +834,123 @@ namespace cci_utils {
     cci_param_predicate& pred,
     const cci_originator& originator) const
   {
+    if (m_lazy_param_ranges) {
+      std::shared_ptr<const cci_param_handle_sequence::param_list> params =
+        lazy_params();
+      if (params) {
+        return cci_param_range(pred,
+                               cci_param_handle_sequence(params, originator));
+      }
+    }
     return cci_param_range(pred,
                            get_param_handles(originator));
   }
 
+  bool consuming_broker::visit_params(param_visitor& visitor,
+                                      const cci_originator& originator) const
+  {
+    entry_visitor v(visitor);
+    return m_registry.for_each_sorted(v);
+  }
+
+  bool consuming_broker::for_each_param(const cci_param_visitor& visitor,
+                                        const cci_originator& originator) const
+  {
+    view_visitor v(visitor, originator);
+    return visit_params(v, originator);
+  }
+
+  std::vector<cci_param_untyped_handle>
+    consuming_broker::get_changed_param_handles(uint64 generation,
+                                                const cci_originator& originator) const
+  {
+    std::vector<cci_param_untyped_handle> param_handles;
+    // nothing has been written anywhere, skip the walk
+    if (generation >= cci_param_untyped::current_write_generation())
+      return param_handles;
+    handle_collector collector(param_handles, originator);
+    visit_changed_params(generation, collector, originator);
+    return param_handles;
+  }
+
+  bool consuming_broker::visit_changed_params(cci::uint64 generation,
+                                              param_visitor& visitor,
+                                              const cci_originator& originator) const
+  {
+    if (m_untracked_params) {
+      changed_filter v(visitor, generation);
+      return consuming_broker::visit_params(v, originator);
+    }
+
+    // the nodes are ordered by write, the result by name
+    std::vector<cci_param_if*> params;
+    const cci_impl::write_node* n;
+    for (n = m_written.last; n && n->generation > generation; n = n->prev) {
+      if (n->param->get_write_generation() > generation)
+        params.push_back(n->param);
+    }
+    std::sort(params.begin(), params.end(), param_name_less);
+    param_registry::walk_scope walk(m_registry);
+    for (std::size_t i = 0; i < params.size(); ++i) {
+      if (!visitor.visit_param(*params[i]))
+        return false;
+    }
+    return true;
+  }
+
+  std::shared_ptr<const cci_param_handle_sequence::param_list>
+    consuming_broker::lazy_params() const
+  {
+    if (!m_lazy_params) {
+      std::shared_ptr<cci_param_handle_sequence::param_list> params =
+        std::make_shared<cci_param_handle_sequence::param_list>();
+      params->params.reserve(m_registry.size());
+      param_collector collector(params->params);
+      consuming_broker::visit_params(collector, cci_originator());
+      m_lazy_params = params;
+    }
+    return m_lazy_params;
+  }
+
+  void consuming_broker::set_lazy_param_ranges(bool enable)
+  {
+    m_lazy_param_ranges = enable;
+  }
+
+  bool consuming_broker::has_lazy_param_ranges() const
+  {
+    return m_lazy_param_ranges;
+  }
+
+  void consuming_broker::freeze()
+  {
+    m_registry.freeze();
+  }
+
+  bool consuming_broker::is_frozen() const
+  {
+    return m_registry.is_frozen();
+  }
+
+  void consuming_broker::set_preset_bundle(
+    const std::shared_ptr<const preset_bundle>& bundle)
+  {
+    m_bundle = bundle;
+    m_bundle_consumed.assign(m_bundle ? m_bundle->size() : 0, false);
+    if (!m_bundle)
+      return;
+
+    // presets of already registered parameters are consumed
+    param_registry::const_iterator it;
+    for (it = m_registry.begin(); it != m_registry.end(); ++it) {
+      if (!(*it)->param)
+        continue;
+      const std::size_t i = m_bundle->find((*it)->name.c_str());
+      if (i != preset_bundle::npos)
+        m_bundle_consumed[i] = true;
+    }
+  }
+
   bool consuming_broker::is_global_broker() const
   {
     return false;
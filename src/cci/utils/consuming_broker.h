@@ -20,8 +20,8 @@
 #ifndef CCI_UTILS_CONSUMING_BROKER_H_INCLUDED_
 #define CCI_UTILS_CONSUMING_BROKER_H_INCLUDED_
 
-#include <map>
-#include <set>
+#include <memory>
+#include <vector>
 
 #include "cci/core/cci_name_gen.h"
 #include "cci/cfg/cci_broker_if.h"
@@ -30,6 +30,8 @@
 #include "cci/cfg/cci_param_if.h"
 #include "cci/cfg/cci_report_handler.h"
 #include "cci/cfg/cci_broker_callbacks.h"
+#include "cci/utils/param_registry.h"
+#include "cci/utils/preset_bundle.h"
 
 namespace cci_utils {
 
@@ -42,6 +44,13 @@ namespace cci_utils {
    * This broker consumes all parameters, and does not have any mechanism to
    * pass parameters to a 'global' broker. It is therefore a good candidate for
    * the global broker.
+   *
+   * Parameter access subscriptions (see register_pre_write_subscription) take
+   * a name pattern as accepted by param_pattern and observe the parameters
+   * registered with this broker.  A parameter only keeps the set of its
+   * observed events (updated when the parameter is added or the
+   * subscriptions change), the matching subscriptions are looked up when
+   * an observed access is dispatched.
    * 
    */
   class consuming_broker: public cci::cci_broker_if
@@ -75,6 +84,16 @@ public:
       const cci::cci_value &cci_value,
       const cci::cci_originator& originator);
 
+    /// Set the preset values of several parameters (requires originator)
+    std::vector<std::string> set_preset_cci_values(
+      const std::vector<cci::cci_name_value_pair>& presets,
+      const cci::cci_originator& originator);
+
+    /// Set the preset values of several parameters, taking over the values
+    std::vector<std::string> set_preset_cci_values(
+      std::vector<cci::cci_name_value_pair>&& presets,
+      const cci::cci_originator& originator);
+
     /// Lock parameter
     void lock_preset_value(const std::string &parname);
 
@@ -103,6 +122,27 @@ public:
     cci::cci_param_range get_param_handles(cci::cci_param_predicate& pred,
                                       const cci::cci_originator& originator) const;
 
+    bool for_each_param(const cci::cci_param_visitor& visitor,
+                        const cci::cci_originator& originator) const;
+
+    std::vector<cci::cci_param_untyped_handle>
+    get_changed_param_handles(cci::uint64 generation,
+                              const cci::cci_originator& originator) const;
+
+    /// Return handles of all parameters matching a name pattern
+    /**
+     * Only the matching parameters are visited, e.g. "top.cpu.**" returns
+     * top.cpu itself and all parameters below it, and "top.*.l2.size"
+     * returns the l2.size parameters of all direct children of top.
+     *
+     * @param pattern    hierarchical name pattern, see param_registry::match()
+     * @param originator originator of the returned handles
+     * @return handles of the matching parameters, ordered by name
+     */
+    virtual std::vector<cci::cci_param_untyped_handle>
+    find_param_handles(const std::string& pattern,
+                       const cci::cci_originator& originator) const;
+
     bool has_preset_value(const std::string &parname) const;
 
     void add_param(cci::cci_param_if* par);
@@ -127,28 +167,190 @@ public:
     unregister_destroy_callback(const cci::cci_param_destroy_callback_handle& cb,
                                 const cci::cci_originator& orig);
 
+    cci::cci_callback_untyped_handle
+    register_pre_write_subscription(
+      const std::string& pattern,
+      const cci::cci_param_pre_write_callback_untyped& cb,
+      const cci::cci_originator& orig);
+
+    cci::cci_callback_untyped_handle
+    register_post_write_subscription(
+      const std::string& pattern,
+      const cci::cci_param_post_write_callback_untyped& cb,
+      const cci::cci_originator& orig);
+
+    cci::cci_callback_untyped_handle
+    register_pre_read_subscription(
+      const std::string& pattern,
+      const cci::cci_param_pre_read_callback_untyped& cb,
+      const cci::cci_originator& orig);
+
+    cci::cci_callback_untyped_handle
+    register_post_read_subscription(
+      const std::string& pattern,
+      const cci::cci_param_post_read_callback_untyped& cb,
+      const cci::cci_originator& orig);
+
+    bool unregister_subscription(const cci::cci_callback_untyped_handle& cb,
+                                 const cci::cci_originator& orig);
+
     bool unregister_all_callbacks(const cci::cci_originator& orig);
 
     bool has_callbacks() const;
+
+    /// Enable lazy parameter ranges
+    /**
+     * When enabled, get_param_handles(cci::cci_param_predicate&, ...) returns
+     * a range, which refers to the registered parameters directly and only
+     * accesses them through a single, unregistered cursor handle while it
+     * is iterated, see cci::cci_param_handle_sequence.  Once one of the
+     * parameters has been destroyed, all elements of such a range are
+     * invalid handles.
+     * Brokers forwarding to a parent broker return regular ranges.
+     *
+     * @param enable whether to return lazy parameter ranges
+     */
+    void set_lazy_param_ranges(bool enable = true);
+
+    /// Returns true, if lazy parameter ranges are enabled
+    bool has_lazy_param_ranges() const;
+
+    /// Compact the parameter and preset database
+    /**
+     * Intended to be called once the set of parameters is (mostly) static,
+     * e.g. at the end of the elaboration.  Relocates the database into a
+     * contiguous, name-ordered layout to speed up parameter lookups and
+     * walks during the simulation (see param_registry::freeze()).
+     * Parameters can still be added and removed afterwards, which ends
+     * the frozen state (see is_frozen()).
+     */
+    void freeze();
+
+    /// Returns true, if the database has not been modified since freeze()
+    bool is_frozen() const;
+
+    /// Use a preset bundle as additional preset value store
+    /**
+     * The presets of the bundle are looked up by name when a parameter is
+     * registered and only decoded, if the parameter consumes them.  Preset
+     * values set via set_preset_cci_value take precedence over the bundled
+     * presets of the same name.
+     *
+     * @param bundle preset bundle (or NULL, to drop the current bundle)
+     */
+    void set_preset_bundle(const std::shared_ptr<const preset_bundle>& bundle);
     
+    /// Visitor of the parameters visible through a broker
+    struct param_visitor
+    {
+      /// Visit a parameter, return false to abort the walk
+      virtual bool visit_param(cci::cci_param_if& param) = 0;
+
+      /// Visit a parameter only reachable via a handle (foreign broker)
+      /**
+       * @return false to abort the walk (e.g. if the visitor does not
+       *         accept handles)
+       */
+      virtual bool visit_handle(const cci::cci_param_untyped_handle& handle)
+        { return false; }
+
+    protected:
+      ~param_visitor() {}
+    };
+
   protected:
+    friend class broker;
+
+    /// Set the preset values of several parameters (internal method)
+    /**
+     * Applies the whole batch like set_preset_cci_values, but does not
+     * report the locked preset values.  This allows brokers to apply all
+     * parts of a batch (e.g. the local and the exposed presets) before
+     * reporting the rejected presets once.
+     *
+     * @return names of the parameters whose preset value is locked
+     */
+    virtual std::vector<std::string> merge_preset_cci_values(
+      const std::vector<cci::cci_name_value_pair>& presets,
+      const cci::cci_originator& originator);
+
+    /// @copydoc merge_preset_cci_values(const std::vector<cci::cci_name_value_pair>&, const cci::cci_originator&)
+    /**
+     * The preset values are taken over, i.e. swapped out of the batch.
+     */
+    virtual std::vector<std::string> merge_preset_cci_values(
+      std::vector<cci::cci_name_value_pair>&& presets,
+      const cci::cci_originator& originator);
+
+    /// Visit all parameters visible through this broker (internal method)
+    /**
+     * The parameters are visited in place: the local parameters (ordered by
+     * name) first, followed by the parameters of the parent brokers.  No
+     * handles are created, unless a parent broker is only accessible via
+     * the cci::cci_broker_if interface.
+     *
+     * @param visitor    visitor to call for each parameter
+     * @param originator originator for requesting handles from a parent
+     * @return false, if the walk has been aborted (see param_visitor)
+     */
+    virtual bool visit_params(param_visitor& visitor,
+                              const cci::cci_originator& originator) const;
+
+    /// Visit the parameters written since a generation (internal method)
+    /**
+     * Like visit_params, but only the parameters with a write generation
+     * greater than @a generation are visited.  The local parameters are
+     * taken from the write list of this broker, i.e. the cost depends on
+     * the number of written parameters, not on the number of parameters.
+     *
+     * @param generation write generation sampled before the previous poll
+     * @param visitor    visitor to call for each written parameter
+     * @param originator originator for requesting handles from a parent
+     * @return false, if the walk has been aborted (see param_visitor)
+     */
+    virtual bool visit_changed_params(cci::uint64 generation,
+                                      param_visitor& visitor,
+                                      const cci::cci_originator& originator) const;
+
+    /// Parameters referred to by lazy ranges (internal method)
+    /**
+     * The list (ordered by name) is shared by all lazy ranges and only
+     * rebuilt after a parameter has been added or removed.  Removing a
+     * parameter marks the list stale.
+     *
+     * @return the parameter list, or NULL if the parameters of this broker
+     *         cannot be listed (lazy ranges are not supported then)
+     */
+    virtual std::shared_ptr<const cci::cci_param_handle_sequence::param_list>
+      lazy_params() const;
+
     /// Get original parameter (internal method)
     cci::cci_param_if* get_orig_param(const std::string &parname) const;
 
     std::string m_name;
 
-    // These are used as a database of _preset_ values.
-    std::map<std::string, cci::cci_param_if*> m_param_registry;
-    std::map<std::string, cci::cci_value> m_unused_value_registry;
-    std::map<std::string, cci::cci_value> m_used_value_registry;
-    
-    // store the list of locked param's (guessing there are many fewer of these
-    // than actual params, so hopefully this is more efficient than adding a
-    // boolean above)
-    std::set<std::string> locked;
+    /// Database of parameters and _preset_ values (indexed by name)
+    param_registry m_registry;
+
+    /// Return lazy parameter ranges
+    bool m_lazy_param_ranges;
+    /// Parameter list of the lazy ranges (dropped on add/remove_param)
+    mutable std::shared_ptr<cci::cci_param_handle_sequence::param_list>
+      m_lazy_params;
+
+    /// Local parameters, ordered by their latest write
+    cci::cci_impl::write_list m_written;
+    /// Number of local parameters missing from m_written
+    std::size_t m_untracked_params;
 
-    /// Map to save the latest write originator when preset values are set
-    std::map<std::string, cci::cci_originator> m_preset_value_originator_map;
+    /// Index of the bundled preset of a parameter (or preset_bundle::npos)
+    std::size_t bundled_preset(const std::string& parname) const;
+
+    /// Bundled preset values (optional)
+    std::shared_ptr<const preset_bundle> m_bundle;
+
+    /// Consumed state of the bundled preset values
+    std::vector<bool> m_bundle_consumed;
 
     template<class T>
     struct callback_obj {
@@ -172,6 +374,71 @@ public:
 
     /// Ignored unconsumed preset cci values
     std::vector<cci::cci_preset_value_predicate> m_ignored_unconsumed_predicates;
+
+    /// Parameter access subscription
+    struct subscription {
+      subscription(const std::string& pat,
+                   const cci::cci_callback_untyped_handle& cb,
+                   int ev, const cci::cci_originator& orig):
+              pattern(pat), callback(cb), event(ev), originator(orig),
+              removed(false) {}
+      param_pattern pattern;
+      cci::cci_callback_untyped_handle callback;
+      int event; ///< single cci::cci_param_event_mask bit
+      cci::cci_originator originator;
+      bool removed; ///< unregistered during a dispatch (erased afterwards)
+    };
+
+    /// Parameter access subscriptions
+    std::vector<std::shared_ptr<subscription> > m_subscriptions;
+
+  private:
+    /// Merge a batch of preset values, optionally taking over the values
+    std::vector<std::string> merge_presets(
+      std::vector<cci::cci_name_value_pair>& presets,
+      const cci::cci_originator& originator,
+      bool take_values);
+
+    /// Report the presets rejected by a batch (if any)
+    static void report_rejected_presets(const std::vector<std::string>& rejected);
+
+    /// Originator of a preset value, shared with the previous presets of
+    /// the same originator
+    std::shared_ptr<const cci::cci_originator>
+    shared_preset_originator(const cci::cci_originator& originator);
+
+    /// Originator of the latest preset values
+    std::shared_ptr<const cci::cci_originator> m_preset_originator;
+
+    /// Dispatches the observed accesses of all parameters to the
+    /// matching subscriptions
+    class param_observer;
+
+    cci::cci_callback_untyped_handle
+    subscribe(const std::string& pattern,
+              const cci::cci_callback_untyped_handle& cb,
+              int event, const cci::cci_originator& orig);
+
+    /// Drop a subscription (only marked removed during a dispatch)
+    void unsubscribe(std::size_t index);
+
+    /// Erase the subscriptions removed during a dispatch
+    void purge_subscriptions();
+
+    /// Update the observed events of a parameter
+    void observe(cci::cci_param_if& param);
+
+    /// Update the observed events of the parameters matching a pattern
+    void update_observed_events(const std::string& pattern);
+
+    /// Observer of all parameters with observed events
+    std::unique_ptr<param_observer> m_observer;
+
+    /// Nesting depth of dispatched parameter accesses
+    unsigned m_dispatching;
+
+    /// Subscriptions have been removed during a dispatch
+    bool m_removed_subscriptions;
   };
 
 }
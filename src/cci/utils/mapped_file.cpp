@@ -0,0 +1,83 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+****************************************************************************/
+
+#include "cci/utils/mapped_file.h"
+
+#include <fstream>
+#include <sstream>
+
+#if !defined(_WIN32)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace cci_utils {
+
+  mapped_file::mapped_file(const std::string& filename)
+    : m_map(NULL), m_data(NULL), m_size(0), m_open(false)
+  {
+#if !defined(_WIN32)
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      return;
+    struct stat st;
+    if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+      m_size = static_cast<std::size_t>(st.st_size);
+      m_open = true;
+      if (m_size) {
+        void* p = ::mmap(NULL, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+# ifdef MADV_SEQUENTIAL
+          ::madvise(p, m_size, MADV_SEQUENTIAL);
+# endif
+          m_map = p;
+          m_data = static_cast<const char*>(p);
+        } else {
+          m_open = false;
+        }
+      }
+    }
+    ::close(fd);
+    if (m_open)
+      return;
+#endif
+    // fallback: read the whole file
+    std::ifstream is(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!is)
+      return;
+    std::ostringstream ss;
+    ss << is.rdbuf();
+    const std::string contents = ss.str();
+    m_buffer.assign(contents.begin(), contents.end());
+    m_data = m_buffer.empty() ? NULL : &m_buffer[0];
+    m_size = m_buffer.size();
+    m_open = true;
+  }
+
+  mapped_file::~mapped_file()
+  {
+#if !defined(_WIN32)
+    if (m_map)
+      ::munmap(m_map, m_size);
+#endif
+  }
+
+} // namespace cci_utils
@@ -0,0 +1,61 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+#ifndef CCI_UTILS_MAPPED_FILE_H_INCLUDED_
+#define CCI_UTILS_MAPPED_FILE_H_INCLUDED_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace cci_utils {
+
+  /// Read-only contents of a file
+  /**
+   * The file is memory mapped where available and read into memory
+   * otherwise.  The contents are suitably aligned for any fundamental type.
+   */
+  class mapped_file
+  {
+  public:
+    explicit mapped_file(const std::string& filename);
+    ~mapped_file();
+
+    /// Returns true, if the file has been opened successfully
+    bool is_open() const { return m_open; }
+    /// File contents (NULL for an empty file)
+    const char* data() const { return m_data; }
+    /// File size
+    std::size_t size() const { return m_size; }
+
+  private:
+    void*             m_map;
+    std::vector<char> m_buffer;
+    const char*       m_data;
+    std::size_t       m_size;
+    bool              m_open;
+
+    // Disabled
+    mapped_file(const mapped_file&);
+    mapped_file& operator=(const mapped_file&);
+  };
+
+} // namespace cci_utils
+
+#endif // CCI_UTILS_MAPPED_FILE_H_INCLUDED_
@@ -0,0 +1,534 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+****************************************************************************/
+
+#include "cci/utils/param_registry.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <new>
+
+namespace cci_utils {
+  using namespace cci;
+
+  namespace {
+    const std::size_t initial_slots = 64;
+
+    struct node_segment_less
+    {
+      template<typename Node>
+      bool operator()(const Node* n, const std::string& s) const
+        { return n->segment < s; }
+    };
+
+    struct entry_name_less
+    {
+      bool operator()(const param_registry::entry* a,
+                      const param_registry::entry* b) const
+        { return param_registry::name_less(a->name.c_str(), b->name.c_str()); }
+    };
+
+    /// rank of a character in the name order (hierarchy separator first)
+    unsigned name_rank(char c)
+    {
+      if (c == sc_core::SC_HIERARCHY_CHAR)
+        return 1;
+      return c ? static_cast<unsigned char>(c) + 1u : 0u;
+    }
+
+    /// split a hierarchical name into its levels
+    void split_name(const char* name, std::vector<std::string>& levels)
+    {
+      const char* begin = name;
+      for (const char* it = name; ; ++it) {
+        if (*it == sc_core::SC_HIERARCHY_CHAR || *it == '\0') {
+          levels.push_back(std::string(begin, it));
+          if (*it == '\0')
+            break;
+          begin = it + 1;
+        }
+      }
+    }
+
+    bool is_any_levels(const std::string& a, const std::string& b)
+    {
+      return a == "**" && b == "**";
+    }
+
+    /// split a name pattern, collapsing consecutive "**" levels
+    std::vector<std::string> split_pattern(const std::string& pattern)
+    {
+      std::vector<std::string> levels;
+      split_name(pattern.c_str(), levels);
+      std::vector<std::string>::iterator it =
+        std::unique(levels.begin(), levels.end(), is_any_levels);
+      levels.erase(it, levels.end());
+      return levels;
+    }
+
+    bool has_wildcard(const std::string& s)
+    {
+      return s.find_first_of("*?") != std::string::npos;
+    }
+
+    /// match a single hierarchy level [str,end) against a glob ('*' and '?')
+    bool match_level(const char* pat, const char* str, const char* end)
+    {
+      const char* star = NULL;
+      const char* retry = NULL;
+      while (str != end) {
+        if (*pat == '?' || *pat == *str) {
+          ++pat;
+          ++str;
+        } else if (*pat == '*') {
+          star = pat++;
+          retry = str;
+        } else if (star) {
+          pat = star + 1;
+          str = ++retry;
+        } else {
+          return false;
+        }
+      }
+      while (*pat == '*')
+        ++pat;
+      return *pat == '\0';
+    }
+
+    /// end of the hierarchy level starting at name
+    const char* level_end(const char* name)
+    {
+      while (*name && *name != sc_core::SC_HIERARCHY_CHAR)
+        ++name;
+      return name;
+    }
+
+    /// start of the next hierarchy level (NULL after the last level)
+    const char* next_level(const char* name)
+    {
+      const char* end = level_end(name);
+      return *end ? end + 1 : NULL;
+    }
+  }
+
+  param_pattern::param_pattern(const std::string& pattern)
+    : m_pattern(pattern)
+    , m_levels(split_pattern(pattern))
+    , m_any(m_levels.size() == 1 && m_levels[0] == "**")
+  {}
+
+  bool param_pattern::matches(const char* name) const
+  {
+    return m_any || match(0, name);
+  }
+
+  bool param_pattern::match(std::size_t p, const char* name) const
+  {
+    // name points to the current level (NULL, if all levels are consumed)
+    for (; p < m_levels.size(); ++p) {
+      if (m_levels[p] == "**") {
+        for (;; name = next_level(name)) {
+          if (match(p + 1, name))
+            return true;
+          if (!name)
+            return false;
+        }
+      }
+      if (!name)
+        return false;
+      const char* end = level_end(name);
+      if (!match_level(m_levels[p].c_str(), name, end))
+        return false;
+      name = *end ? end + 1 : NULL;
+    }
+    return name == NULL;
+  }
+
+  param_registry::node*
+  param_registry::node::child(const std::string& s) const
+  {
+    child_iterator it = std::lower_bound(children.begin(), children.end(),
+                                         s, node_segment_less());
+    return (it != children.end() && (*it)->segment == s) ? *it : NULL;
+  }
+
+  param_registry::param_registry()
+    : m_slots(initial_slots)
+    , m_root(NULL)
+    , m_block(NULL)
+    , m_block_size(0)
+    , m_node_block(NULL)
+    , m_node_block_size(0)
+    , m_frozen(false)
+    , m_walks(0)
+  {}
+
+  param_registry::~param_registry()
+  {
+    for (std::size_t i = 0; i < m_entries.size(); ++i)
+      destroy(m_entries[i]);
+    ::operator delete(m_block);
+    trie_clear(m_root);
+    ::operator delete(m_node_block);
+  }
+
+  void param_registry::destroy(entry* e)
+  {
+    std::less<const entry*> less;
+    if (m_block && !less(e, m_block) && less(e, m_block + m_block_size))
+      e->~entry();
+    else
+      delete e;
+  }
+
+  void param_registry::destroy(node* n)
+  {
+    std::less<const node*> less;
+    if (m_node_block && !less(n, m_node_block)
+        && less(n, m_node_block + m_node_block_size))
+      n->~node();
+    else
+      delete n;
+  }
+
+  param_registry::entry* param_registry::relocate(entry& from, void* to)
+  {
+    // the preset value and its originator are taken over, not copied
+    entry* e = new (to) entry(from.name);
+    e->param = from.param;
+    e->preset.swap(from.preset);
+    e->preset_originator.swap(from.preset_originator);
+    e->has_preset = from.has_preset;
+    e->consumed = from.consumed;
+    e->locked = from.locked;
+    e->forwarded = from.forwarded;
+    e->index = from.index;
+    e->trie = from.trie;
+    return e;
+  }
+
+  std::size_t param_registry::slot_of(const cci_name_atom& name) const
+  {
+    const std::size_t mask = m_slots.size() - 1;
+    std::size_t i = name.hash() & mask;
+    while (m_slots[i].e && m_slots[i].name != name)
+      i = (i + 1) & mask;
+    return i;
+  }
+
+  param_registry::entry* param_registry::find(const cci_name_atom& name) const
+  {
+    if (name.is_null())
+      return NULL;
+    return m_slots[slot_of(name)].e;
+  }
+
+  param_registry::entry* param_registry::find(const char* name) const
+  {
+    if (!name)
+      return NULL;
+    return find(name, std::strlen(name));
+  }
+
+  param_registry::entry*
+  param_registry::find(const char* name, std::size_t length) const
+  {
+    const std::size_t h = cci_name_atom::hash(name, length);
+    const std::size_t mask = m_slots.size() - 1;
+    for (std::size_t i = h & mask; m_slots[i].e; i = (i + 1) & mask) {
+      const slot& s = m_slots[i];
+      if (s.hash == h && s.name.length() == length
+          && std::memcmp(s.name.c_str(), name, length) == 0)
+        return s.e;
+    }
+    return NULL;
+  }
+
+  param_registry::entry&
+  param_registry::insert(const cci_name_atom& name)
+  {
+    sc_assert(!name.is_null() && "Unable to register a null name");
+    std::size_t i = slot_of(name);
+    if (m_slots[i].e)
+      return *m_slots[i].e;
+    sc_assert(!m_walks && "Registry entries added during a walk");
+
+    // keep the load factor below 3/4
+    if ((m_entries.size() + 1) * 4 > m_slots.size() * 3) {
+      rehash(m_slots.size() * 2);
+      i = slot_of(name);
+    }
+
+    entry* e = new entry(name);
+    e->index = m_entries.size();
+    m_entries.push_back(e);
+    m_slots[i].name = name;
+    m_slots[i].hash = name.hash();
+    m_slots[i].e = e;
+    trie_insert(*e);
+    m_frozen = false;
+    return *e;
+  }
+
+  void param_registry::release(entry& e)
+  {
+    if (!e.param && !e.has_preset && !e.locked && !e.forwarded)
+      erase(e);
+  }
+
+  void param_registry::erase(entry& e)
+  {
+    const std::size_t mask = m_slots.size() - 1;
+    std::size_t i = slot_of(e.name);
+    sc_assert(m_slots[i].e == &e && "Entry is not part of this registry");
+    sc_assert(!m_walks && "Registry entries dropped during a walk");
+
+    // backward-shift deletion keeps probe sequences intact without tombstones
+    m_slots[i] = slot();
+    for (std::size_t j = (i + 1) & mask; m_slots[j].e; j = (j + 1) & mask) {
+      const std::size_t home = m_slots[j].hash & mask;
+      // leave the entry in place, if its home slot lies cyclically in (i,j]
+      if (i <= j ? (i < home && home <= j) : (i < home || home <= j))
+        continue;
+      m_slots[i] = m_slots[j];
+      m_slots[j] = slot();
+      i = j;
+    }
+
+    trie_erase(e);
+
+    // swap-remove from the dense list
+    entry* last = m_entries.back();
+    m_entries[e.index] = last;
+    last->index = e.index;
+    m_entries.pop_back();
+    destroy(&e);
+    m_frozen = false;
+  }
+
+  void param_registry::reserve(std::size_t count)
+  {
+    std::size_t slots = m_slots.size();
+    while (count * 4 > slots * 3)
+      slots *= 2;
+    if (slots != m_slots.size())
+      rehash(slots);
+    // grow geometrically, repeated batches must not copy the list each time
+    if (count > m_entries.capacity())
+      m_entries.reserve(std::max(count, 2 * m_entries.capacity()));
+  }
+
+  void param_registry::rehash(std::size_t count)
+  {
+    sc_assert(!m_walks && "Registry rehashed during a walk");
+    std::vector<slot> slots(count);
+    const std::size_t mask = slots.size() - 1;
+    for (std::size_t k = 0; k < m_entries.size(); ++k) {
+      std::size_t i = m_entries[k]->name.hash() & mask;
+      while (slots[i].e)
+        i = (i + 1) & mask;
+      slots[i].name = m_entries[k]->name;
+      slots[i].hash = m_entries[k]->name.hash();
+      slots[i].e = m_entries[k];
+    }
+    m_slots.swap(slots);
+  }
+
+  void param_registry::freeze()
+  {
+    sc_assert(!m_walks && "Registry frozen during a walk");
+    std::vector<const entry*> order = sorted();
+    const std::size_t count = order.size();
+
+    // move the entries, in trie order
+    entry* block = count
+      ? static_cast<entry*>(::operator new(count * sizeof(entry))) : NULL;
+    for (std::size_t k = 0; k < count; ++k) {
+      entry* old = const_cast<entry*>(order[k]);
+      entry* e = relocate(*old, block + k);
+      e->index = k;
+      e->trie->e = e;
+      m_entries[k] = e;
+      destroy(old);
+    }
+    ::operator delete(m_block);
+    m_block = block;
+    m_block_size = count;
+
+    // move the trie nodes, in depth-first order
+    std::vector<node*> nodes(1, &m_root);
+    for (std::size_t k = 0; k < nodes.size(); ++k)
+      nodes.insert(nodes.end(),
+                   nodes[k]->children.begin(), nodes[k]->children.end());
+    const std::size_t node_count = nodes.size() - 1;
+    node* node_block = node_count
+      ? static_cast<node*>(::operator new(node_count * sizeof(node))) : NULL;
+    relocate_children(m_root, node_block, 0);
+    ::operator delete(m_node_block);
+    m_node_block = node_block;
+    m_node_block_size = node_count;
+
+    // rebuild the index at a load factor of at most 1/2
+    std::size_t slots = initial_slots;
+    while (slots < 2 * count)
+      slots *= 2;
+    rehash(slots);
+    std::vector<entry*>(m_entries).swap(m_entries);
+    m_frozen = true;
+  }
+
+  void param_registry::collect(const node& n, std::vector<const entry*>& result)
+  {
+    if (n.e)
+      result.push_back(n.e);
+    for (child_iterator it = n.children.begin(); it != n.children.end(); ++it)
+      collect(**it, result);
+  }
+
+  std::vector<const param_registry::entry*> param_registry::sorted() const
+  {
+    if (m_frozen) // the dense list is ordered by name
+      return std::vector<const entry*>(m_entries.begin(), m_entries.end());
+    std::vector<const entry*> result;
+    result.reserve(m_entries.size());
+    collect(m_root, result);
+    return result;
+  }
+
+  void param_registry::trie_insert(entry& e)
+  {
+    std::vector<std::string> levels;
+    split_name(e.name.c_str(), levels);
+
+    node* n = &m_root;
+    for (std::size_t i = 0; i < levels.size(); ++i) {
+      std::vector<node*>::iterator it =
+        std::lower_bound(n->children.begin(), n->children.end(),
+                         levels[i], node_segment_less());
+      if (it == n->children.end() || (*it)->segment != levels[i])
+        it = n->children.insert(it, new node(n, levels[i]));
+      n = *it;
+    }
+    sc_assert(!n->e && "Name already present in the hierarchy");
+    n->e = &e;
+    e.trie = n;
+  }
+
+  void param_registry::trie_clear(node& n)
+  {
+    for (child_iterator it = n.children.begin(); it != n.children.end(); ++it) {
+      trie_clear(**it);
+      destroy(*it);
+    }
+    n.children.clear();
+  }
+
+  std::size_t
+  param_registry::relocate_children(node& n, node* block, std::size_t next)
+  {
+    for (std::size_t i = 0; i < n.children.size(); ++i) {
+      node* old = n.children[i];
+      node* c = new (block + next++) node(&n);
+      c->segment.swap(old->segment);
+      c->children.swap(old->children);
+      c->e = old->e;
+      if (c->e)
+        c->e->trie = c;
+      for (child_iterator it = c->children.begin(); it != c->children.end(); ++it)
+        (*it)->parent = c;
+      n.children[i] = c;
+      destroy(old);
+      next = relocate_children(*c, block, next);
+    }
+    return next;
+  }
+
+  void param_registry::trie_erase(entry& e)
+  {
+    node* n = e.trie;
+    n->e = NULL;
+    e.trie = NULL;
+    // prune empty branches
+    while (n != &m_root && !n->e && n->children.empty()) {
+      node* parent = n->parent;
+      parent->children.erase(
+        std::lower_bound(parent->children.begin(), parent->children.end(),
+                         n->segment, node_segment_less()));
+      destroy(n);
+      n = parent;
+    }
+  }
+
+  void param_registry::match(const node& n,
+                             const std::vector<std::string>& pattern,
+                             std::size_t level,
+                             std::vector<const entry*>& result)
+  {
+    if (level == pattern.size()) {
+      if (n.e)
+        result.push_back(n.e);
+      return;
+    }
+
+    const std::string& pat = pattern[level];
+    child_iterator it;
+    if (pat == "**") {
+      // zero levels
+      match(n, pattern, level + 1, result);
+      // one or more levels
+      for (it = n.children.begin(); it != n.children.end(); ++it)
+        match(**it, pattern, level, result);
+    } else if (has_wildcard(pat)) {
+      for (it = n.children.begin(); it != n.children.end(); ++it) {
+        const std::string& segment = (*it)->segment;
+        if (match_level(pat.c_str(), segment.c_str(),
+                        segment.c_str() + segment.size()))
+          match(**it, pattern, level + 1, result);
+      }
+    } else if (const node* child = n.child(pat)) {
+      match(*child, pattern, level + 1, result);
+    }
+  }
+
+  std::vector<const param_registry::entry*>
+  param_registry::match(const std::string& pattern) const
+  {
+    std::vector<const entry*> result;
+    match(m_root, split_pattern(pattern), 0, result);
+    // "**" may reach the same entry along different paths
+    std::sort(result.begin(), result.end(), entry_name_less());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+  }
+
+  bool param_registry::name_less(const char* a, const char* b)
+  {
+    while (*a && *a == *b) {
+      ++a;
+      ++b;
+    }
+    return name_rank(*a) < name_rank(*b);
+  }
+
+  bool param_registry::matches(const std::string& pattern, const char* name)
+  {
+    return param_pattern(pattern).matches(name);
+  }
+
+} // namespace cci_utils
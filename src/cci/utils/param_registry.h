@@ -0,0 +1,318 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+#ifndef CCI_UTILS_PARAM_REGISTRY_H_INCLUDED_
+#define CCI_UTILS_PARAM_REGISTRY_H_INCLUDED_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cci/core/cci_name_atom.h"
+#include "cci/cfg/cci_originator.h"
+#include "cci/cfg/cci_param_if.h"
+#include "cci/core/cci_value.h"
+
+namespace cci_utils {
+
+  /// Hierarchical parameter name pattern
+  /**
+   * The pattern is split into its hierarchy levels.  Each level is matched
+   * against the corresponding level of a name and may contain the
+   * wildcards '*' (any sequence of characters) and '?' (any character).
+   * A level consisting of "**" matches any number of hierarchy levels,
+   * including none.
+   *
+   * Examples:
+   *  - "top.cpu.core3.**" matches top.cpu.core3 itself and all names below
+   *    it ("top.cpu.core3.*.**" matches the names below it only)
+   *  - "top.*.l2.size" matches top.cpu0.l2.size, top.dsp.l2.size, ...
+   *
+   * The pattern is preprocessed once, matching a name does not allocate.
+   */
+  class param_pattern
+  {
+  public:
+    explicit param_pattern(const std::string& pattern);
+
+    /// Check, whether a hierarchical name matches this pattern
+    bool matches(const char* name) const;
+
+    /// The pattern string
+    const std::string& str() const { return m_pattern; }
+
+  private:
+    bool match(std::size_t level, const char* name) const;
+
+    std::string              m_pattern;
+    std::vector<std::string> m_levels;
+    bool                     m_any;   ///< pattern matches any name
+  };
+
+  /// Hash-indexed registry of parameters and preset values
+  /**
+   * Keeps everything a broker knows about a parameter name (the registered
+   * parameter, its preset value and preset originator, and the consumed and
+   * locked state) in a single entry, so that any query on a name is answered
+   * by a single probe into an open-addressing (linear probing) hash index.
+   * Entries are keyed by interned names (see cci::cci_name_atom).
+   *
+   * In addition, the entries are organized in a trie following the object
+   * hierarchy (names split at sc_core::SC_HIERARCHY_CHAR), which allows to
+   * answer scoped queries (see match()) in time proportional to the size of
+   * the visited sub-hierarchies instead of the total number of entries.
+   *
+   * Entries are heap allocated and never move while they are registered,
+   * except for freeze(), which relocates all entries into a single block.
+   * An entry is dropped as soon as it carries no information anymore
+   * (see release()).
+   */
+  class param_registry
+  {
+    struct node;
+
+  public:
+    /// Registry entry, one per known parameter name
+    struct entry
+    {
+      explicit entry(const cci::cci_name_atom& n)
+        : name(n), param(NULL), preset(), preset_originator()
+        , has_preset(false), consumed(false), locked(false)
+        , forwarded(false), index(0), trie(NULL)
+      {}
+
+      /// Full hierarchical parameter name
+      cci::cci_name_atom name;
+      /// Registered parameter (or NULL)
+      cci::cci_param_if* param;
+      /// Preset value (valid if has_preset)
+      cci::cci_value preset;
+      /// Originator of the latest preset value (valid if has_preset),
+      /// shared by the presets of a batch
+      std::shared_ptr<const cci::cci_originator> preset_originator;
+
+      bool has_preset; ///< a preset value has been set
+      bool consumed;   ///< the preset has been consumed by a parameter
+      bool locked;     ///< the preset value is locked
+      bool forwarded;  ///< the parameter has been added to a parent broker
+
+    private:
+      friend class param_registry;
+      std::size_t index; ///< position in the dense entry list
+      node* trie;        ///< position in the hierarchy trie
+    };
+
+    typedef std::vector<entry*>::const_iterator const_iterator;
+
+    param_registry();
+    ~param_registry();
+
+    /// Find the entry of the given name (or NULL)
+    entry* find(const cci::cci_name_atom& name) const;
+    /// @copydoc find(const cci::cci_name_atom&) const
+    /**
+     * The name is hashed and compared directly, i.e. without looking it
+     * up in the intern table first.
+     */
+    entry* find(const std::string& name) const
+      { return find(name.data(), name.size()); }
+    /// @copydoc find(const std::string&) const
+    entry* find(const char* name) const;
+
+    /// Find the entry of the given name, create it if needed
+    entry& insert(const cci::cci_name_atom& name);
+
+    /// Drop the entry if it neither holds a parameter, a preset, a lock
+    /// nor a forwarded parameter
+    void release(entry& e);
+
+    /// Prepare the registry for the given total number of entries
+    void reserve(std::size_t count);
+
+    /// Number of entries
+    std::size_t size() const { return m_entries.size(); }
+
+    /// Compact the registry for read-mostly access
+    /**
+     * Moves all entries into a single contiguous block, ordered by name
+     * (see name_less()), moves the nodes of the hierarchy trie into a
+     * second block in depth-first order, and rebuilds the hash index at a
+     * low load factor.  As long as no entries are inserted or dropped
+     * afterwards, ordered walks (see for_each_sorted()) iterate the entry
+     * block instead of the hierarchy trie.  Later modifications are still
+     * supported (new entries and nodes are allocated individually), but
+     * end the frozen state.
+     *
+     * @note All references to entries are invalidated.
+     */
+    void freeze();
+
+    /// Returns true, if the registry has not been modified since freeze()
+    bool is_frozen() const { return m_frozen; }
+
+    /// Iteration over all entries (unspecified order)
+    const_iterator begin() const { return m_entries.begin(); }
+    const_iterator end() const { return m_entries.end(); }
+
+    /// Collect all entries, ordered by name (see name_less())
+    /**
+     * The entries are collected by walking the hierarchy trie.
+     */
+    std::vector<const entry*> sorted() const;
+
+    /// Marks a walk over the registry, for the lifetime of the scope
+    /**
+     * Entries must neither be inserted nor dropped, and the registry must
+     * not be rehashed or frozen while a walk is in progress (asserted).
+     */
+    class walk_scope
+    {
+    public:
+      explicit walk_scope(const param_registry& r) : m_registry(r)
+        { ++m_registry.m_walks; }
+      ~walk_scope() { --m_registry.m_walks; }
+
+    private:
+      const param_registry& m_registry;
+    };
+
+    /// Returns true, if a walk over the registry is in progress
+    bool is_walking() const { return m_walks != 0; }
+
+    /// Visit all entries in place, ordered by name (see name_less())
+    /**
+     * Walks the hierarchy trie like sorted(), but without collecting the
+     * entries first.  The registry must not be modified during the walk
+     * (see walk_scope).
+     *
+     * @param visitor function object called with each (const) entry,
+     *                returning false to stop the walk
+     * @return false, if the walk has been stopped
+     */
+    template<typename Visitor>
+    bool for_each_sorted(Visitor& visitor) const
+    {
+      walk_scope walk(*this);
+      if (!m_frozen)
+        return visit(m_root, visitor);
+      // the dense list is ordered by name while frozen
+      for (std::size_t i = 0; i < m_entries.size(); ++i)
+        if (!visitor(*m_entries[i]))
+          return false;
+      return true;
+    }
+
+    /// Collect all entries matching a hierarchical name pattern
+    /**
+     * @param pattern name pattern (see param_pattern)
+     * @return matching entries, ordered by name (see name_less())
+     */
+    std::vector<const entry*> match(const std::string& pattern) const;
+
+    /// Order of the names in all ordered walks and queries
+    /**
+     * Names are compared level by level, i.e. like std::strcmp, except
+     * that the hierarchy separator sorts before any other character.
+     * This is the order of a depth-first walk of the hierarchy trie:
+     * "top.a" and "top.a.x" sort before "top.a_b".
+     */
+    static bool name_less(const char* a, const char* b);
+
+    /// Check, whether a hierarchical name matches the given pattern
+    /// @see param_pattern
+    static bool matches(const std::string& pattern, const char* name);
+
+  private:
+    struct node
+    {
+      explicit node(node* p, const std::string& s = std::string())
+        : parent(p), segment(s), e(NULL) {}
+
+      /// child of the given segment (or NULL)
+      node* child(const std::string& s) const;
+
+      node* parent;
+      std::string segment;
+      entry* e;
+      /// children, ordered by segment
+      std::vector<node*> children;
+    };
+    typedef std::vector<node*>::const_iterator child_iterator;
+
+    void trie_insert(entry& e);
+    void trie_erase(entry& e);
+    void trie_clear(node& n);
+    std::size_t relocate_children(node& n, node* block, std::size_t next);
+    static void collect(const node& n, std::vector<const entry*>& result);
+    template<typename Visitor>
+    static bool visit(const node& n, Visitor& visitor)
+    {
+      if (n.e && !visitor(*n.e))
+        return false;
+      for (child_iterator it = n.children.begin(); it != n.children.end(); ++it)
+        if (!visit(**it, visitor))
+          return false;
+      return true;
+    }
+    static void match(const node& n, const std::vector<std::string>& pattern,
+                      std::size_t level, std::vector<const entry*>& result);
+
+    /// hash index slot, keeps the key and its hash inline to avoid
+    /// probing the entries and the interned names
+    struct slot
+    {
+      slot() : name(), hash(0), e(NULL) {}
+      cci::cci_name_atom name;
+      std::size_t hash;
+      entry* e;
+    };
+
+    entry* find(const char* name, std::size_t length) const;
+    std::size_t slot_of(const cci::cci_name_atom& name) const;
+    void rehash(std::size_t slots);
+    void erase(entry& e);
+    void destroy(entry* e);
+    void destroy(node* n);
+    static entry* relocate(entry& from, void* to);
+
+    /// hash index (power-of-two sized, NULL entry marks an empty slot)
+    std::vector<slot> m_slots;
+    /// dense list of entries, for iteration
+    std::vector<entry*> m_entries;
+    /// hierarchy trie (root node)
+    node m_root;
+    /// storage of the entries relocated by freeze()
+    entry* m_block;
+    std::size_t m_block_size;
+    /// storage of the trie nodes relocated by freeze()
+    node* m_node_block;
+    std::size_t m_node_block_size;
+    /// not modified since freeze()
+    bool m_frozen;
+    /// number of walks in progress (see walk_scope)
+    mutable unsigned m_walks;
+
+    // Disabled
+    param_registry(const param_registry&);
+    param_registry& operator=(const param_registry&);
+  };
+
+} // namespace cci_utils
+
+#endif // CCI_UTILS_PARAM_REGISTRY_H_INCLUDED_
@@ -0,0 +1,465 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+****************************************************************************/
+
+#include "cci/utils/preset_bundle.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "cci/cfg/cci_report_handler.h"
+
+namespace cci_utils {
+  using namespace cci;
+
+  namespace {
+    const char* const bundle_id = "cci_utils/preset_bundle";
+
+    const char bundle_magic[8] = { 'C', 'C', 'I', 'P', 'R', 'E', 'S', 'B' };
+    const std::uint32_t bundle_byte_order = 0x01020304u;
+
+    /// average number of names per hash bucket
+    const std::size_t bucket_load = 4;
+    /// maximum number of seeds tried per bucket
+    const std::uint32_t max_seed = 1u << 24;
+
+    /// 64-bit FNV-1a, followed by a finalizer mixing the lower bits
+    std::uint64_t name_hash(const char* name, std::size_t length)
+    {
+      std::uint64_t h = 14695981039346656037ull;
+      for (std::size_t i = 0; i < length; ++i) {
+        h ^= static_cast<unsigned char>(name[i]);
+        h *= 1099511628211ull;
+      }
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdull;
+      h ^= h >> 33;
+      return h;
+    }
+
+    /// slot of a name hash, displaced by the seed of its bucket
+    std::size_t slot_of(std::uint64_t h, std::uint32_t seed, std::size_t count)
+    {
+      h ^= seed * 0x9e3779b97f4a7c15ull;
+      h ^= h >> 29;
+      h *= 0xbf58476d1ce4e5b9ull;
+      h ^= h >> 32;
+      return static_cast<std::size_t>(h % count);
+    }
+
+    std::size_t bucket_count(std::size_t count)
+    {
+      return count / bucket_load + 1;
+    }
+
+    std::size_t align(std::size_t offset)
+    {
+      return (offset + 7) & ~static_cast<std::size_t>(7);
+    }
+
+    /// bucket of the perfect hash construction
+    struct bucket
+    {
+      std::size_t index;
+      std::vector<std::size_t> keys; ///< indices of the member names
+    };
+
+    bool larger_bucket(const bucket* a, const bucket* b)
+    {
+      return a->keys.size() > b->keys.size();
+    }
+
+    /// true, if [offset, offset + count * elem_size) lies within size bytes
+    bool fits(std::uint64_t offset, std::uint64_t count,
+              std::size_t elem_size, std::size_t size)
+    {
+      return offset <= size && count <= (size - offset) / elem_size;
+    }
+
+    /// Decode the scalars written by cci_value::to_json directly
+    /**
+     * Integers, booleans, null and strings without escape sequences are
+     * converted without running the JSON parser, everything else is
+     * passed to cci_value::from_json.
+     */
+    cci_value decode(const char* json)
+    {
+      cci_value v;
+      const char* p = json;
+      switch (*p) {
+      case 'n':
+        if (std::strcmp(p, "null") == 0)
+          return v;
+        break;
+      case 't':
+      case 'f':
+        if (std::strcmp(p, "true") == 0 || std::strcmp(p, "false") == 0) {
+          v.set_bool(*p == 't');
+          return v;
+        }
+        break;
+      case '"':
+        for (++p; static_cast<unsigned char>(*p) >= 0x20
+                  && *p != '"' && *p != '\\'; ++p) {}
+        if (*p == '"' && p[1] == '\0') {
+          v.set_string(std::string(json + 1, p));
+          return v;
+        }
+        break;
+      default: {
+        // at most 18 digits, no overflow
+        const bool negative = (*p == '-');
+        if (negative)
+          ++p;
+        const char* digits = p;
+        std::int64_t n = 0;
+        for (; *p >= '0' && *p <= '9' && p - digits < 18; ++p)
+          n = n * 10 + (*p - '0');
+        const std::ptrdiff_t length = p - digits;
+        if (*p == '\0' && length > 0 && (*digits != '0' || length == 1)) {
+          v.set_int64(negative ? -n : n);
+          return v;
+        }
+      }
+      }
+      return cci_value::from_json(json);
+    }
+  } // anonymous namespace
+
+  const std::size_t preset_bundle::npos;
+  const unsigned preset_bundle::version;
+
+  /// File header (all offsets relative to the start of the file)
+  struct preset_bundle::header
+  {
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t size;        ///< file size
+    std::uint64_t count;       ///< number of presets
+    std::uint64_t buckets;     ///< number of hash buckets
+    std::uint64_t originators; ///< number of originators
+    std::uint64_t seeds;       ///< offset of the bucket seeds
+    std::uint64_t records;     ///< offset of the records
+    std::uint64_t origins;     ///< offset of the originator records
+    std::uint64_t strings;     ///< offset of the string table
+  };
+
+  /// Preset record, strings are null-terminated within the string table
+  struct preset_bundle::record
+  {
+    std::uint64_t hash;
+    std::uint64_t name;       ///< offset of the name
+    std::uint64_t value;      ///< offset of the JSON value
+    std::uint32_t name_length;
+    std::uint32_t originator; ///< index of the originator
+  };
+
+  // ---------------------------------------------------------------------
+  // builder
+
+  void preset_bundle::builder::add(const std::string& name,
+                                   const cci_value& value,
+                                   const cci_originator& originator)
+  {
+    preset& p = m_presets[name];
+    p.value = value.to_json();
+    p.originator = originator.name();
+  }
+
+  bool preset_bundle::builder::write(const std::string& filename) const
+  {
+    const std::size_t count = m_presets.size();
+    const std::size_t buckets = bucket_count(count);
+
+    // collect names and hashes (and the distinct originators)
+    std::vector<std::map<std::string, preset>::const_iterator> presets;
+    std::vector<std::uint64_t> hashes;
+    std::vector<std::string> origins;
+    std::map<std::string, std::uint32_t> origin_index;
+    presets.reserve(count);
+    hashes.reserve(count);
+    std::map<std::string, preset>::const_iterator it;
+    for (it = m_presets.begin(); it != m_presets.end(); ++it) {
+      presets.push_back(it);
+      hashes.push_back(name_hash(it->first.data(), it->first.size()));
+      if (origin_index.insert(std::make_pair(
+            it->second.originator,
+            static_cast<std::uint32_t>(origins.size()))).second)
+        origins.push_back(it->second.originator);
+    }
+
+    // hash and displace: place the buckets (largest first) by searching a
+    // seed, which maps all of its names to distinct free slots
+    std::vector<bucket> table(buckets);
+    for (std::size_t i = 0; i < count; ++i)
+      table[hashes[i] % buckets].keys.push_back(i);
+    std::vector<bucket*> order(buckets);
+    for (std::size_t b = 0; b < buckets; ++b) {
+      table[b].index = b;
+      order[b] = &table[b];
+    }
+    std::stable_sort(order.begin(), order.end(), larger_bucket);
+
+    std::vector<std::uint32_t> seeds(buckets);
+    std::vector<std::size_t> slots(count, npos); // slot -> preset
+    std::vector<std::size_t> placed;
+    for (std::size_t b = 0; b < buckets && !order[b]->keys.empty(); ++b) {
+      const std::vector<std::size_t>& keys = order[b]->keys;
+      std::uint32_t seed = 0;
+      for (;;) {
+        placed.clear();
+        std::size_t k = 0;
+        for (; k < keys.size(); ++k) {
+          const std::size_t s = slot_of(hashes[keys[k]], seed, count);
+          if (slots[s] != npos
+              || std::find(placed.begin(), placed.end(), s) != placed.end())
+            break;
+          placed.push_back(s);
+        }
+        if (k == keys.size())
+          break;
+        if (++seed == max_seed) {
+          std::stringstream ss;
+          ss << "Unable to build the name index of preset bundle '"
+             << filename << "' (colliding name '"
+             << presets[keys.front()]->first << "')";
+          CCI_REPORT_ERROR(bundle_id, ss.str().c_str());
+          return false;
+        }
+      }
+      seeds[order[b]->index] = seed;
+      for (std::size_t k = 0; k < keys.size(); ++k)
+        slots[placed[k]] = keys[k];
+    }
+
+    // layout
+    header h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, bundle_magic, sizeof(h.magic));
+    h.version = version;
+    h.byte_order = bundle_byte_order;
+    h.count = count;
+    h.buckets = buckets;
+    h.originators = origins.size();
+    h.seeds = align(sizeof(header));
+    h.records = align(h.seeds + buckets * sizeof(std::uint32_t));
+    h.origins = align(h.records + count * sizeof(record));
+    h.strings = align(h.origins + origins.size() * sizeof(std::uint64_t));
+
+    std::string strings;
+    std::vector<record> records(count);
+    for (std::size_t s = 0; s < count; ++s) {
+      const std::string& name = presets[slots[s]]->first;
+      const preset& p = presets[slots[s]]->second;
+      record& r = records[s];
+      std::memset(&r, 0, sizeof(r));
+      r.hash = hashes[slots[s]];
+      r.name = strings.size();
+      r.name_length = static_cast<std::uint32_t>(name.size());
+      strings.append(name).push_back('\0');
+      r.value = strings.size();
+      strings.append(p.value).push_back('\0');
+      r.originator = origin_index[p.originator];
+    }
+    std::vector<std::uint64_t> origin_offsets(origins.size());
+    for (std::size_t i = 0; i < origins.size(); ++i) {
+      origin_offsets[i] = strings.size();
+      strings.append(origins[i]).push_back('\0');
+    }
+    h.size = h.strings + strings.size();
+
+    // write
+    std::ofstream os(filename.c_str(),
+                     std::ios::out | std::ios::binary | std::ios::trunc);
+    const char padding[8] = {};
+    std::size_t pos = 0;
+    os.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    pos += sizeof(h);
+    os.write(padding, h.seeds - pos);
+    if (buckets)
+      os.write(reinterpret_cast<const char*>(&seeds[0]),
+               buckets * sizeof(std::uint32_t));
+    pos = h.seeds + buckets * sizeof(std::uint32_t);
+    os.write(padding, h.records - pos);
+    if (count)
+      os.write(reinterpret_cast<const char*>(&records[0]),
+               count * sizeof(record));
+    pos = h.records + count * sizeof(record);
+    os.write(padding, h.origins - pos);
+    if (!origins.empty())
+      os.write(reinterpret_cast<const char*>(&origin_offsets[0]),
+               origins.size() * sizeof(std::uint64_t));
+    pos = h.origins + origins.size() * sizeof(std::uint64_t);
+    os.write(padding, h.strings - pos);
+    os.write(strings.data(), strings.size());
+    os.close();
+
+    if (!os) {
+      std::stringstream ss;
+      ss << "Cannot write preset bundle '" << filename << "'";
+      CCI_REPORT_ERROR(bundle_id, ss.str().c_str());
+      return false;
+    }
+    return true;
+  }
+
+  // ---------------------------------------------------------------------
+  // bundle access
+
+  preset_bundle::preset_bundle(const std::string& filename)
+    : m_file(filename)
+    , m_count(0)
+    , m_buckets(0)
+    , m_seeds(NULL)
+    , m_records(NULL)
+    , m_strings(NULL)
+  {
+    if (!m_file.is_open()) {
+      std::stringstream ss;
+      ss << "Cannot open preset bundle '" << filename << "'";
+      CCI_REPORT_ERROR(bundle_id, ss.str().c_str());
+      return;
+    }
+    if (!validate(filename)) {
+      m_count = 0;
+      m_seeds = NULL;
+      m_records = NULL;
+      m_strings = NULL;
+      m_originators.clear();
+    }
+  }
+
+  bool preset_bundle::validate(const std::string& filename)
+  {
+    const char* data = m_file.data();
+    const std::size_t size = m_file.size();
+    const header* h = reinterpret_cast<const header*>(data);
+
+    const char* error = NULL;
+    if (size < sizeof(header)
+        || std::memcmp(h->magic, bundle_magic, sizeof(h->magic)) != 0)
+      error = "not a preset bundle";
+    else if (h->version != version || h->byte_order != bundle_byte_order)
+      error = "unsupported version or platform";
+    else if (h->size != size
+             || h->buckets != bucket_count(h->count)
+             || h->seeds < sizeof(header) || h->seeds % 8
+             || h->records % 8 || h->origins % 8
+             || !fits(h->seeds, h->buckets, sizeof(std::uint32_t), size)
+             || !fits(h->records, h->count, sizeof(record), size)
+             || !fits(h->origins, h->originators, sizeof(std::uint64_t), size)
+             || h->records < h->seeds + h->buckets * sizeof(std::uint32_t)
+             || h->origins < h->records + h->count * sizeof(record)
+             || h->strings < h->origins
+                             + h->originators * sizeof(std::uint64_t)
+             || h->strings > size
+             || (size > h->strings && data[size - 1] != '\0')
+             || !validate_records(data, size))
+      error = "corrupt file";
+
+    if (error) {
+      std::stringstream ss;
+      ss << "Cannot use preset bundle '" << filename << "' (" << error << ")";
+      CCI_REPORT_ERROR(bundle_id, ss.str().c_str());
+      return false;
+    }
+
+    m_count = static_cast<std::size_t>(h->count);
+    m_buckets = static_cast<std::size_t>(h->buckets);
+    m_seeds = reinterpret_cast<const std::uint32_t*>(data + h->seeds);
+    m_records = reinterpret_cast<const record*>(data + h->records);
+    m_strings = data + h->strings;
+
+    // originators are shared by all presets, create them once
+    const std::uint64_t* origins =
+      reinterpret_cast<const std::uint64_t*>(data + h->origins);
+    m_originators.reserve(static_cast<std::size_t>(h->originators));
+    for (std::size_t i = 0; i < h->originators; ++i)
+      m_originators.push_back(cci_originator(std::string(m_strings + origins[i])));
+    return true;
+  }
+
+  bool preset_bundle::validate_records(const char* data, std::size_t size) const
+  {
+    // strings are terminated by the last byte of the file (see validate)
+    const header* h = reinterpret_cast<const header*>(data);
+    const std::size_t strings = static_cast<std::size_t>(size - h->strings);
+    const char* table = data + h->strings;
+
+    const record* records = reinterpret_cast<const record*>(data + h->records);
+    for (std::size_t i = 0; i < h->count; ++i) {
+      const record& r = records[i];
+      if (r.name >= strings || r.name_length >= strings - r.name
+          || table[r.name + r.name_length] != '\0'
+          || r.value >= strings || r.originator >= h->originators)
+        return false;
+    }
+
+    const std::uint64_t* origins =
+      reinterpret_cast<const std::uint64_t*>(data + h->origins);
+    for (std::size_t i = 0; i < h->originators; ++i)
+      if (origins[i] >= strings)
+        return false;
+    return true;
+  }
+
+  std::size_t preset_bundle::find(const char* name, std::size_t length) const
+  {
+    if (!m_count)
+      return npos;
+    const std::uint64_t h = name_hash(name, length);
+    const std::size_t s = slot_of(h, m_seeds[h % m_buckets], m_count);
+    const record& r = m_records[s];
+    if (r.hash != h || r.name_length != length
+        || std::memcmp(m_strings + r.name, name, length) != 0)
+      return npos;
+    return s;
+  }
+
+  std::size_t preset_bundle::find(const char* name) const
+  {
+    return name ? find(name, std::strlen(name)) : npos;
+  }
+
+  std::size_t preset_bundle::find(const std::string& name) const
+  {
+    return find(name.data(), name.size());
+  }
+
+  const char* preset_bundle::name(std::size_t index) const
+  {
+    sc_assert(index < m_count && "Invalid preset bundle index");
+    return m_strings + m_records[index].name;
+  }
+
+  cci_value preset_bundle::value(std::size_t index) const
+  {
+    sc_assert(index < m_count && "Invalid preset bundle index");
+    return decode(m_strings + m_records[index].value);
+  }
+
+  const cci_originator& preset_bundle::originator(std::size_t index) const
+  {
+    sc_assert(index < m_count && "Invalid preset bundle index");
+    return m_originators[m_records[index].originator];
+  }
+
+} // namespace cci_utils
@@ -0,0 +1,141 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+#ifndef CCI_UTILS_PRESET_BUNDLE_H_INCLUDED_
+#define CCI_UTILS_PRESET_BUNDLE_H_INCLUDED_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "cci/core/cci_value.h"
+#include "cci/cfg/cci_originator.h"
+#include "cci/utils/mapped_file.h"
+
+namespace cci_utils {
+
+  /// Compiled, read-only set of preset values
+  /**
+   * A preset bundle is a versioned binary file holding the names, the
+   * (JSON encoded) values and the originators of a set of preset values,
+   * together with a minimal perfect hash index over the names.  Bundles
+   * are created with preset_bundle::builder and memory mapped when opened.
+   * Opening a bundle checks the bounds of all records, but neither copies
+   * the names nor decodes the values: a value is only decoded when it is
+   * requested (see value()).
+   *
+   * The originators of the presets are created when the bundle is opened,
+   * i.e. a bundle should be opened outside of the SystemC hierarchy
+   * (see cci::cci_originator(const std::string&)).
+   *
+   * Bundles are platform specific (byte order), a bundle created on a
+   * different platform or by a different version is rejected when opened.
+   *
+   * @see consuming_broker::set_preset_bundle
+   */
+  class preset_bundle
+  {
+    struct header;
+    struct record;
+
+  public:
+    /// Index returned by find() for unknown names
+    static const std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// Version of the bundle format
+    static const unsigned version = 1;
+
+    /// Creates preset bundle files
+    class builder
+    {
+    public:
+      /// Add a preset value (replacing an earlier value of the same name)
+      void add(const std::string& name, const cci::cci_value& value,
+               const cci::cci_originator& originator);
+
+      /// Number of added preset values
+      std::size_t size() const { return m_presets.size(); }
+
+      /// Write the bundle file
+      /**
+       * @param filename name of the file to (over)write
+       * @return false, if the file could not be written (error reported)
+       */
+      bool write(const std::string& filename) const;
+
+    private:
+      struct preset
+      {
+        std::string value;      ///< JSON encoded value
+        std::string originator; ///< originator name
+      };
+      std::map<std::string, preset> m_presets;
+    };
+
+    /// Opens a bundle file (errors are reported, see is_open())
+    explicit preset_bundle(const std::string& filename);
+
+    /// Returns true, if the bundle has been opened successfully
+    bool is_open() const { return m_records != NULL; }
+
+    /// Number of preset values
+    std::size_t size() const { return m_count; }
+
+    /// Index of the preset value of a parameter (or npos)
+    std::size_t find(const char* name) const;
+    /// @copydoc find(const char*) const
+    std::size_t find(const std::string& name) const;
+
+    /// Name of the parameter of a preset value
+    const char* name(std::size_t index) const;
+
+    /// Decode a preset value
+    /**
+     * Scalar values (integers, booleans, null and plain strings) are
+     * converted directly, other values are parsed with
+     * cci::cci_value::from_json.
+     */
+    cci::cci_value value(std::size_t index) const;
+
+    /// Originator of a preset value
+    const cci::cci_originator& originator(std::size_t index) const;
+
+  private:
+    std::size_t find(const char* name, std::size_t length) const;
+    bool validate(const std::string& filename);
+    bool validate_records(const char* data, std::size_t size) const;
+
+    mapped_file                      m_file;
+    std::size_t                      m_count;
+    std::size_t                      m_buckets;
+    const std::uint32_t*             m_seeds;   ///< per hash bucket
+    const record*                    m_records; ///< ordered by hash slot
+    const char*                      m_strings;
+    std::vector<cci::cci_originator> m_originators;
+
+    // Disabled
+    preset_bundle(const preset_bundle&);
+    preset_bundle& operator=(const preset_bundle&);
+  };
+
+} // namespace cci_utils
+
+#endif // CCI_UTILS_PRESET_BUNDLE_H_INCLUDED_
@@ -0,0 +1,359 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+****************************************************************************/
+
+#include "cci/utils/preset_loader.h"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "cci/core/rapidjson.h"
+#include "rapidjson/memorystream.h"
+#include "cci/cfg/cci_report_handler.h"
+#include "cci/utils/mapped_file.h"
+
+namespace cci_utils {
+  using namespace cci;
+
+  namespace {
+    namespace rapidjson = RAPIDJSON_NAMESPACE;
+
+    const char* const loader_id = "cci_utils/preset_loader";
+
+    /// Syntax error in the preset input
+    struct parse_error
+    {
+      parse_error(std::size_t off, const std::string& msg)
+        : offset(off), what(msg) {}
+      std::size_t offset;
+      std::string what;
+    };
+
+    /// Builds the preset values from the parser events
+    /**
+     * The values are constructed in place within the current batch of
+     * presets, which is passed to the broker once it is full.  A value is
+     * only committed to the batch once the input following it has been
+     * accepted as well (the next key or the end of the object, the end of
+     * the line respectively), so a preset followed by a syntax error is
+     * never applied.
+     */
+    class preset_handler
+      : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, preset_handler>
+    {
+    public:
+      preset_handler(cci_broker_handle& broker, std::size_t batch_size,
+                     bool outer_object)
+        : m_broker(broker), m_batch_size(batch_size)
+        , m_outer_object(outer_object), m_in_outer_object(false)
+        , m_committed(0), m_count(0)
+      {
+        m_batch.reserve(m_batch_size);
+      }
+
+      /// Set the name of the next preset (line format)
+      void set_name(const char* name, std::size_t len)
+        { m_name.assign(name, len); }
+
+      /// Accept the presets parsed so far
+      void commit()
+      {
+        m_committed = m_batch.size();
+        if (m_committed >= m_batch_size)
+          flush();
+      }
+
+      /// Pass the committed presets to the broker
+      void flush()
+      {
+        if (m_committed == 0)
+          return;
+        // the broker takes over the values
+        m_broker.set_preset_cci_values(CCI_MOVE_(m_batch));
+        m_count += m_committed;
+        m_batch.clear();
+        m_batch.reserve(m_batch_size);
+        m_committed = 0;
+      }
+
+      /// Drop the presets parsed since the last commit
+      void discard_uncommitted()
+      {
+        m_stack.clear();
+        m_batch.erase(m_batch.begin() + m_committed, m_batch.end());
+      }
+
+      std::size_t count() const { return m_count; }
+
+      bool Null()             { value().set_null();      return true; }
+      bool Bool(bool b)       { value().set_bool(b);     return true; }
+      bool Int(int i)         { value().set_int(i);      return true; }
+      bool Uint(unsigned u)   { value().set_uint(u);     return true; }
+      bool Int64(int64 i)     { value().set_int64(i);    return true; }
+      bool Uint64(uint64 u)   { value().set_uint64(u);   return true; }
+      bool Double(double d)   { value().set_double(d);   return true; }
+
+      bool String(const char* s, rapidjson::SizeType len, bool)
+        { value().set_string(s, len); return true; }
+
+      bool StartArray()
+      {
+        cci_value_ref v = value();
+        v.set_list();
+        m_stack.push_back(v);
+        return true;
+      }
+
+      bool EndArray(rapidjson::SizeType)
+      {
+        m_stack.pop_back();
+        return true;
+      }
+
+      bool StartObject()
+      {
+        if (m_stack.empty() && m_outer_object && !m_in_outer_object) {
+          m_in_outer_object = true; // names of the presets follow
+          return true;
+        }
+        cci_value_ref v = value();
+        v.set_map();
+        m_stack.push_back(v);
+        return true;
+      }
+
+      bool Key(const char* s, rapidjson::SizeType len, bool)
+      {
+        if (m_stack.empty()) {
+          commit(); // the previous preset is followed by a separator
+          m_name.assign(s, len);
+        } else {
+          m_key.assign(s, len);
+        }
+        return true;
+      }
+
+      bool EndObject(rapidjson::SizeType)
+      {
+        if (m_stack.empty()) {
+          commit();
+          m_in_outer_object = false;
+          return true;
+        }
+        m_stack.pop_back();
+        return true;
+      }
+
+    private:
+      /// Slot for the next value
+      cci_value_ref value()
+      {
+        if (m_stack.empty()) {
+          // new preset (no reallocation, the batch is flushed when the
+          // committed presets fill it)
+          m_batch.push_back(cci_name_value_pair(m_name, cci_value()));
+          return m_batch.back().second.set_null();
+        }
+
+        cci_value_ref parent = m_stack.back();
+        if (parent.is_list()) {
+          cci_value_list_ref list = parent.get_list();
+          list.push_back(cci_value_cref(m_null));
+          return list[list.size() - 1];
+        }
+        return parent.get_map()[m_key].set_null();
+      }
+
+      cci_broker_handle&               m_broker;
+      const std::size_t                m_batch_size;
+      const bool                       m_outer_object;
+      bool                             m_in_outer_object;
+      std::size_t                      m_committed; ///< accepted presets
+      std::size_t                      m_count;
+      std::vector<cci_name_value_pair> m_batch;
+      std::vector<cci_value_ref>       m_stack;  ///< open lists and maps
+      std::string                      m_name;   ///< current preset name
+      std::string                      m_key;    ///< current map key
+      const cci_value                  m_null;
+    };
+
+    inline bool is_blank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+    const char* skip_blanks(const char* p, const char* end)
+    {
+      while (p != end && is_blank(*p))
+        ++p;
+      return p;
+    }
+
+    const char* skip_line(const char* p, const char* end)
+    {
+      while (p != end && *p != '\n')
+        ++p;
+      return p;
+    }
+
+    /// Parse a single JSON value of the line format
+    const char* parse_value(rapidjson::Reader& reader, preset_handler& handler,
+                            const char* begin, const char* p, const char* end)
+    {
+      rapidjson::MemoryStream is(p, static_cast<std::size_t>(end - p));
+      try {
+        reader.Parse<rapidjson::kParseDefaultFlags
+                     | rapidjson::kParseStopWhenDoneFlag>(is, handler);
+      } catch (const rapidjson::ParseException& ex) {
+        throw parse_error(static_cast<std::size_t>(p - begin) + ex.Offset(),
+                          ex.what());
+      }
+      return p + is.Tell();
+    }
+
+    /// Parse name/value lines
+    void parse_lines(rapidjson::Reader& reader, preset_handler& handler,
+                     const char* begin, const char* end)
+    {
+      const char* p = begin;
+      while (p != end) {
+        p = skip_blanks(p, end);
+        if (p == end)
+          break;
+        if (*p == '\n') {
+          ++p;
+          continue;
+        }
+        if (*p == '#') {
+          p = skip_line(p, end);
+          continue;
+        }
+
+        const char* name = p;
+        while (p != end && !is_blank(*p) && *p != '\n')
+          ++p;
+        handler.set_name(name, static_cast<std::size_t>(p - name));
+
+        p = skip_blanks(p, end);
+        if (p == end || *p == '\n' || *p == '#')
+          throw parse_error(static_cast<std::size_t>(p - begin),
+                            "Missing value.");
+        p = parse_value(reader, handler, begin, p, end);
+
+        p = skip_blanks(p, end);
+        if (p != end && *p == '#')
+          p = skip_line(p, end);
+        if (p != end && *p != '\n')
+          throw parse_error(static_cast<std::size_t>(p - begin),
+                            "Unexpected characters after value.");
+        handler.commit();
+      }
+    }
+
+    /// Parse a JSON object of presets
+    void parse_object(rapidjson::Reader& reader, preset_handler& handler,
+                      const char* begin, const char* end)
+    {
+      const char* p = begin;
+      while (p != end && (is_blank(*p) || *p == '\n'))
+        ++p;
+      if (p == end || *p != '{')
+        throw parse_error(static_cast<std::size_t>(p - begin),
+                          "Expected an object of preset values.");
+
+      rapidjson::MemoryStream is(begin, static_cast<std::size_t>(end - begin));
+      try {
+        reader.Parse<rapidjson::kParseDefaultFlags
+                     | rapidjson::kParseCommentsFlag>(is, handler);
+      } catch (const rapidjson::ParseException& ex) {
+        throw parse_error(ex.Offset(), ex.what());
+      }
+    }
+
+    /// Parse the presets, the number of applied presets is stored in loaded
+    void load_presets(cci_broker_handle& broker, std::size_t batch_size,
+                      const char* data, std::size_t size,
+                      preset_loader::file_format format,
+                      const std::string& source, std::size_t& loaded)
+    {
+      const char* end = data + size;
+      if (format == preset_loader::auto_format) {
+        const char* p = data;
+        while (p != end && (is_blank(*p) || *p == '\n'))
+          ++p;
+        format = (p != end && *p == '{') ? preset_loader::json_format
+                                         : preset_loader::line_format;
+      }
+
+      preset_handler handler(broker, batch_size,
+                             format == preset_loader::json_format);
+      rapidjson::Reader reader;
+      try {
+        if (format == preset_loader::json_format)
+          parse_object(reader, handler, data, end);
+        else
+          parse_lines(reader, handler, data, end);
+      } catch (const parse_error& err) {
+        // keep the presets read so far
+        handler.discard_uncommitted();
+        handler.flush();
+        loaded = handler.count();
+
+        const std::size_t line =
+          1 + static_cast<std::size_t>(std::count(data, data + err.offset, '\n'));
+        std::stringstream ss;
+        ss << source << ":" << line << ": preset parse error: " << err.what
+           << " (offset: " << err.offset << ")";
+        CCI_REPORT_ERROR(loader_id, ss.str().c_str());
+        return;
+      }
+      handler.flush();
+      loaded = handler.count();
+    }
+  } // anonymous namespace
+
+  preset_loader::preset_loader(cci_broker_handle broker)
+    : m_broker(broker)
+    , m_batch_size(4096)
+    , m_loaded(0)
+  {}
+
+  std::size_t preset_loader::load_file(const std::string& filename,
+                                       file_format format)
+  {
+    m_loaded = 0;
+    mapped_file file(filename);
+    if (!file.is_open()) {
+      std::stringstream ss;
+      ss << "Cannot open preset file '" << filename << "'";
+      CCI_REPORT_ERROR(loader_id, ss.str().c_str());
+      return 0;
+    }
+    load_presets(m_broker, m_batch_size, file.data(), file.size(), format,
+                 filename, m_loaded);
+    return m_loaded;
+  }
+
+  std::size_t preset_loader::load(const char* data, std::size_t size,
+                                  file_format format)
+  {
+    m_loaded = 0;
+    load_presets(m_broker, m_batch_size, data, size, format, "<buffer>",
+                 m_loaded);
+    return m_loaded;
+  }
+
+} // namespace cci_utils
@@ -0,0 +1,118 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ ****************************************************************************/
+
+#ifndef CCI_UTILS_PRESET_LOADER_H_INCLUDED_
+#define CCI_UTILS_PRESET_LOADER_H_INCLUDED_
+
+#include <cstddef>
+#include <string>
+
+#include "cci/cfg/cci_broker_handle.h"
+
+namespace cci_utils {
+
+  /// Streaming loader for preset values
+  /**
+   * Reads preset values from a file (or memory buffer) and passes them in
+   * batches to a broker (see cci::cci_broker_if::set_preset_cci_values).
+   * Files are memory mapped and parsed in a single pass, the values are
+   * built directly from the parser events without intermediate documents.
+   *
+   * Two formats are supported:
+   *  - JSON: a single object mapping full parameter names to values, e.g.
+   *    @code
+   *    { "top.cpu.freq": 100, "top.cpu.name": "core0" }
+   *    @endcode
+   *  - line-oriented: one preset per line, consisting of the full parameter
+   *    name and a JSON value, separated by white space.  Empty lines and
+   *    '#' comments are ignored, e.g.
+   *    @code
+   *    # CPU settings
+   *    top.cpu.freq 100
+   *    top.cpu.name "core0"
+   *    @endcode
+   *
+   * A preset is applied only if it is followed by valid input (a separator
+   * or the end of the object, the end of its line respectively).
+   *
+   * Parse errors are reported via CCI_REPORT_ERROR, which throws an
+   * sc_core::sc_report by default.  The presets read before the error have
+   * already been passed to the broker at that point, their number is
+   * available from loaded_count().
+   */
+  class preset_loader
+  {
+  public:
+    /// Input format
+    enum file_format
+    {
+      auto_format, ///< JSON, if the input starts with '{', lines otherwise
+      json_format, ///< JSON object
+      line_format  ///< name/value lines
+    };
+
+    /// Constructs a loader, passing the presets to the given broker
+    explicit preset_loader(cci::cci_broker_handle broker);
+
+    /// Load preset values from a file
+    /**
+     * @param filename name of the file
+     * @param format   format of the file
+     * @return number of preset values passed to the broker
+     *
+     * If the error report does not throw, the number of presets read
+     * before the error is returned.
+     */
+    std::size_t load_file(const std::string& filename,
+                          file_format format = auto_format);
+
+    /// Load preset values from a memory buffer
+    /**
+     * @param data   buffer (not necessarily null-terminated)
+     * @param size   size of the buffer
+     * @param format format of the buffer contents
+     * @return number of preset values passed to the broker
+     *
+     * @see load_file
+     */
+    std::size_t load(const char* data, std::size_t size,
+                     file_format format = auto_format);
+
+    /// Number of presets passed to the broker by the last load
+    /**
+     * Also valid after a failed load, whether or not its error report has
+     * thrown.
+     */
+    std::size_t loaded_count() const { return m_loaded; }
+
+    /// Number of presets passed to the broker at once
+    std::size_t batch_size() const { return m_batch_size; }
+
+    /// Set the number of presets passed to the broker at once
+    void set_batch_size(std::size_t size) { m_batch_size = size ? size : 1; }
+
+  private:
+    cci::cci_broker_handle m_broker;
+    std::size_t            m_batch_size;
+    std::size_t            m_loaded;
+  };
+
+} // namespace cci_utils
+
+#endif // CCI_UTILS_PRESET_LOADER_H_INCLUDED_